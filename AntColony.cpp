@@ -0,0 +1,173 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#include "AntColony.h"
+#include "Simd.h"
+#include "ThreadPool.h"
+#include "TourConstruction.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <numeric>
+
+using namespace std;
+
+#define CANDIDATES 16u
+#define BETA 2.0
+#define RHO 0.02
+
+AntColony::AntColony(const MetricClosure &closure, unsigned ants, unsigned threads, unsigned seed)
+        : closure(closure), localSearch(closure, CANDIDATES), ants(max(1u, ants)), threads(threads), seed(seed) {
+    unsigned n = closure.size();
+    unsigned count = localSearch.getNeighborCount();
+    candidates = simdPadded(max(1u, count));
+
+    double scale = 0.0;
+    for (unsigned i = 0; i < n && count; i++)
+        scale += closure.getDistance(i, localSearch.getNeighbors(i)[0]);
+    scale = n && count ? max(scale / n, 1e-9) : 1.0;
+
+    heuristic.resize((size_t) n * n);
+    for (unsigned i = 0; i < n; i++)
+        for (unsigned j = 0; j < n; j++) {
+            double distance = max(closure.getDistance(i, j), 1e-9 * scale);
+            heuristic[(size_t) i * n + j] = i == j ? 0.0f : (float) pow(scale / distance, BETA);
+        }
+
+    candidateList.assign((size_t) n * candidates, 0);
+    for (unsigned i = 0; i < n; i++) {
+        const unsigned *neighbors = localSearch.getNeighbors(i);
+        for (unsigned k = 0; k < candidates; k++)
+            candidateList[(size_t) i * candidates + k] = k < count ? neighbors[k] : i;
+    }
+    pheromone.assign((size_t) n * n, 1.0f);
+    choice.assign((size_t) n * candidates, 0.0f);
+}
+
+double AntColony::solve(vector<unsigned> &circuit, unsigned iterations, double target) {
+    unsigned n = closure.size();
+    constructed = 0;
+    constructionSeconds = 0.0;
+    if (n < 4) {
+        vector<unsigned> tour(n);
+        iota(tour.begin(), tour.end(), 0);
+        circuit = TourConstruction::toCircuit(tour);
+        return TourConstruction::tourCost(closure, tour);
+    }
+
+    mt19937 rng(seed);
+    vector<unsigned> best = TourConstruction::nearestNeighbor(closure, 0, rng);
+    double bestCost = localSearch.twoOpt(best);
+    tauMax = (float) (1.0 / (RHO * bestCost / n));
+    tauMin = tauMax / (2.0f * n);
+    fill(pheromone.begin(), pheromone.end(), tauMax);
+    updateChoice();
+
+    ThreadPool pool(threads);
+    vector<vector<unsigned>> tours(ants);
+    vector<double> costs(ants);
+    for (unsigned iteration = 0; iteration < iterations && bestCost > target; iteration++) {
+        auto start = chrono::steady_clock::now();
+        for (unsigned a = 0; a < ants; a++)
+            pool.submit([this, a, iteration, &tours] {
+                mt19937 antRng(seed ^ (2654435761u * (iteration + 1) + 40503u * (a + 1)));
+                tours[a] = constructTour(antRng);
+            });
+        pool.wait();
+        constructionSeconds += chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        constructed += ants;
+
+        for (unsigned a = 0; a < ants; a++)
+            pool.submit([this, a, &tours, &costs] {
+                costs[a] = localSearch.twoOpt(tours[a]);
+            });
+        pool.wait();
+
+        unsigned iterationBest = min_element(costs.begin(), costs.end()) - costs.begin();
+        if (costs[iterationBest] < bestCost) {
+            bestCost = costs[iterationBest];
+            best = tours[iterationBest];
+            tauMax = (float) (1.0 / (RHO * bestCost / n));
+            tauMin = tauMax / (2.0f * n);
+        }
+        if (iteration % 10 == 9)
+            updatePheromone(best, bestCost);
+        else
+            updatePheromone(tours[iterationBest], costs[iterationBest]);
+        updateChoice();
+    }
+
+    circuit = TourConstruction::toCircuit(best);
+    return bestCost;
+}
+
+unsigned long long AntColony::getAntsConstructed() const {
+    return constructed;
+}
+
+double AntColony::getAntsPerSecond() const {
+    return constructionSeconds > 0.0 ? constructed / constructionSeconds : 0.0;
+}
+
+vector<unsigned> AntColony::constructTour(mt19937 &rng) const {
+    unsigned n = closure.size();
+    vector<float> unvisited(n, 1.0f);
+    vector<float> mask(candidates);
+    vector<float> weights(candidates);
+    uniform_real_distribution<float> uniform(0.0f, 1.0f);
+    vector<unsigned> tour;
+    tour.reserve(n);
+    unsigned current = uniform_int_distribution<unsigned>(0, n - 1)(rng);
+    unvisited[current] = 0.0f;
+    tour.push_back(current);
+    for (unsigned step = 1; step < n; step++) {
+        const unsigned *candidate = candidateList.data() + (size_t) current * candidates;
+        for (unsigned k = 0; k < candidates; k++)
+            mask[k] = unvisited[candidate[k]];
+        float total = simdMaskedWeights(choice.data() + (size_t) current * candidates, mask.data(), weights.data(),
+                                        candidates);
+        unsigned next;
+        if (total > 0.0f)
+            next = candidate[simdRouletteSelect(weights.data(), candidates, uniform(rng) * total)];
+        else {
+            const float *tau = pheromone.data() + (size_t) current * n;
+            const float *eta = heuristic.data() + (size_t) current * n;
+            next = n;
+            float bestChoice = -1.0f;
+            for (unsigned j = 0; j < n; j++)
+                if (unvisited[j] > 0.0f && tau[j] * eta[j] > bestChoice) {
+                    bestChoice = tau[j] * eta[j];
+                    next = j;
+                }
+        }
+        unvisited[next] = 0.0f;
+        tour.push_back(next);
+        current = next;
+    }
+    return tour;
+}
+
+void AntColony::updateChoice() {
+    unsigned n = closure.size();
+    for (unsigned i = 0; i < n; i++)
+        for (unsigned k = 0; k < candidates; k++) {
+            unsigned j = candidateList[(size_t) i * candidates + k];
+            choice[(size_t) i * candidates + k] = pheromone[(size_t) i * n + j] * heuristic[(size_t) i * n + j];
+        }
+}
+
+void AntColony::updatePheromone(const vector<unsigned> &tour, double cost) {
+    unsigned n = closure.size();
+    float evaporation = (float) (1.0 - RHO);
+    for (float &tau: pheromone)
+        tau = max(tauMin, tau * evaporation);
+    float deposit = (float) (1.0 / (cost / n));
+    for (unsigned i = 0; i < n; i++) {
+        unsigned u = tour[i];
+        unsigned v = tour[(i + 1) % n];
+        float tau = min(tauMax, pheromone[(size_t) u * n + v] + deposit);
+        pheromone[(size_t) u * n + v] = tau;
+        pheromone[(size_t) v * n + u] = tau;
+    }
+}
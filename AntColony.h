@@ -0,0 +1,91 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#ifndef TSP_ANTCOLONY_H
+#define TSP_ANTCOLONY_H
+
+
+#include <random>
+#include <vector>
+#include "LocalSearch.h"
+#include "MetricClosure.h"
+
+class AntColony {
+public:
+    /**@brief Construtor com parâmetros. Prepara um algoritmo MAX-MIN Ant System (MMAS) sobre closure, com matrizes densas de feromona e de informação heurística e listas de candidatos de cada vértice.
+     *
+     * Complexidade Temporal: O(V<SUP>2</SUP> log(k)), sendo V o número de vértices e k o tamanho das listas de candidatos
+     * @param closure fecho métrico do grafo
+     * @param ants número de formigas por iteração
+     * @param threads número de threads a usar (se 0, usa o número de threads suportadas pelo hardware)
+     * @param seed semente do gerador de números aleatórios
+     */
+    AntColony(const MetricClosure &closure, unsigned ants = 25, unsigned threads = 0,
+              unsigned seed = std::random_device()());
+
+    /**@brief Resolve (de forma aproximada) o Travelling Salesperson Problem (TSP): em cada iteração, as formigas constroem circuitos em paralelo (com o cálculo das probabilidades e a seleção por roleta vetorizados com SIMD sobre as listas de candidatos), que são otimizados com 2-opt; depois, a feromona evapora e é depositada no melhor circuito, limitada ao intervalo [tauMin, tauMax].
+     *
+     * Complexidade Temporal: O(I (m V k / T + V<SUP>2</SUP>)), sendo I o número de iterações, m o número de formigas, V o número de vértices, k o tamanho das listas de candidatos e T o número de threads (sem contar com o 2-opt)
+     * @param circuit melhor circuito encontrado (começa e acaba no vértice de id 0)
+     * @param iterations número de iterações
+     * @param target custo alvo: pára no fim da primeira iteração em que o melhor circuito tenha custo menor ou igual (opcional)
+     * @return custo do melhor circuito encontrado
+     */
+    double solve(std::vector<unsigned> &circuit, unsigned iterations, double target = 0.0);
+
+    /**@brief Retorna o número de formigas (circuitos) construídas na última resolução.
+     *
+     * Complexidade Temporal: O(1)
+     * @return número de formigas construídas
+     */
+    unsigned long long getAntsConstructed() const;
+
+    /**@brief Retorna o débito da construção de circuitos na última resolução, i. e., o número de formigas construídas por segundo (só a fase de construção, sem o 2-opt nem a atualização da feromona).
+     *
+     * Complexidade Temporal: O(1)
+     * @return número de formigas construídas por segundo
+     */
+    double getAntsPerSecond() const;
+
+private:
+    const MetricClosure &closure;
+    LocalSearch localSearch;
+    unsigned ants;
+    unsigned threads;
+    unsigned seed;
+    unsigned candidates;
+    std::vector<unsigned> candidateList;
+    std::vector<float> pheromone;
+    std::vector<float> heuristic;
+    std::vector<float> choice;
+    float tauMin = 0.0f;
+    float tauMax = 1.0f;
+    unsigned long long constructed = 0;
+    double constructionSeconds = 0.0;
+
+    /**@brief Constrói o circuito de uma formiga: a partir de um vértice aleatório, escolhe o vértice seguinte por roleta sobre os candidatos por visitar (vetorizada com SIMD) ou, se já foram todos visitados, o vértice por visitar com maior produto feromona × heurística.
+     *
+     * Complexidade Temporal: O(V k / W), sendo V o número de vértices, k o tamanho das listas de candidatos e W a largura SIMD (O(V<SUP>2</SUP>) no pior caso)
+     * @param rng gerador de números aleatórios da formiga
+     * @return circuito construído (permutação dos vértices, sem repetir o vértice inicial no fim)
+     */
+    std::vector<unsigned> constructTour(std::mt19937 &rng) const;
+
+    /**@brief Recalcula a informação de escolha (feromona × heurística) de todos os candidatos de todos os vértices.
+     *
+     * Complexidade Temporal: O(V k), sendo V o número de vértices e k o tamanho das listas de candidatos
+     */
+    void updateChoice();
+
+    /**@brief Evapora a feromona de todas as arestas e deposita feromona nas arestas do circuito tour, de custo cost, limitando-a ao intervalo [tauMin, tauMax].
+     *
+     * Complexidade Temporal: O(V<SUP>2</SUP>), sendo V o número de vértices
+     * @param tour circuito em cujas arestas depositar feromona
+     * @param cost custo do circuito
+     */
+    void updatePheromone(const std::vector<unsigned> &tour, double cost);
+};
+
+
+#endif //TSP_ANTCOLONY_H
@@ -0,0 +1,144 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#include "BalasSimonetti.h"
+#include "DistancePolicy.h"
+#include "MetricSolver.h"
+#include "TourConstruction.h"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+#define BALAS_SIMONETTI_MIN_WINDOW 2u
+#define BALAS_SIMONETTI_MAX_WINDOW 12u
+#define BALAS_SIMONETTI_PASSES 6
+#define BALAS_SIMONETTI_EPSILON 1e-9
+
+using namespace std;
+
+BalasSimonetti::BalasSimonetti(const MetricClosure &closure, unsigned window)
+        : closure(closure),
+          window(max(BALAS_SIMONETTI_MIN_WINDOW, min(window, BALAS_SIMONETTI_MAX_WINDOW))) {}
+
+double BalasSimonetti::optimize(vector<unsigned> &circuit) const {
+    vector<char> seen(closure.size(), false);
+    vector<unsigned> tour;
+    for (unsigned v: circuit) {
+        if (v >= closure.size())
+            throw invalid_argument("O circuito não corresponde ao grafo");
+        if (!seen[v]) {
+            seen[v] = true;
+            tour.push_back(v);
+        }
+    }
+    if (tour.size() != closure.size())
+        throw invalid_argument("O circuito não corresponde ao grafo");
+    double cost = MetricSolver::cost(MatrixDistance(closure), tour);
+    unsigned stale = 0;
+    for (unsigned p = 0; p < BALAS_SIMONETTI_PASSES && stale < 2; p++) {
+        double optimized = pass(tour);
+        stale = optimized < cost - BALAS_SIMONETTI_EPSILON ? 0 : stale + 1;
+        cost = min(cost, optimized);
+        rotate(tour.begin(), tour.begin() + tour.size() / 2, tour.end());
+    }
+    circuit = TourConstruction::toCircuit(tour);
+    return closure.cost(circuit);
+}
+
+unsigned BalasSimonetti::getWindow() const {
+    return window;
+}
+
+double BalasSimonetti::pass(vector<unsigned> &tour) const {
+    unsigned n = tour.size();
+    if (n < 4)
+        return MetricSolver::cost(MatrixDistance(closure), tour);
+    int k = (int) window;
+    unsigned offsets = 2 * k;
+    size_t layer = ((size_t) 1 << (k - 1)) * offsets;
+    double inf = numeric_limits<double>::infinity();
+    vector<double> costs((k + 1) * layer, inf);
+    vector<signed char> pred((size_t) (n + 1) * layer);
+    unsigned subsets = 1u << (k - 1);
+    vector<unsigned> sets(subsets), count(subsets), top(subsets), ones(subsets);
+    for (unsigned s = 0; s < subsets; s++) {
+        sets[s] = s;
+        count[s] = s ? count[s >> 1] + (s & 1) : 0;
+        top[s] = s ? top[s >> 1] + 1 : 0;
+        ones[s] = s & 1 ? ones[s >> 1] + 1 : 0;
+    }
+    stable_sort(sets.begin(), sets.end(), [&count](unsigned a, unsigned b) {
+        return count[a] < count[b];
+    });
+    auto slot = [&costs, k, layer](unsigned a) {
+        return costs.data() + (a % (k + 1)) * layer;
+    };
+
+    slot(1)[k - 1] = 0.0;
+    for (unsigned a = 1; a < n; a++) {
+        fill(slot(a + k), slot(a + k) + layer, inf);
+        double *current = slot(a);
+        for (unsigned set: sets) {
+            if (a + top[set] >= n)
+                continue;
+            int last = (int) (a + top[set]) - (set ? 0 : 1);
+            for (unsigned o = 0; o < offsets; o++) {
+                double value = current[set * offsets + o];
+                if (value == inf)
+                    continue;
+                int l = (int) a - k + (int) o;
+                const double *row = closure.getRow(tour[l]);
+                for (int d = 0; d < k && a + d < n; d++) {
+                    int c = (int) a + d;
+                    if ((d > 0 && (set >> (d - 1)) & 1) || last >= c + k)
+                        continue;
+                    unsigned next = d ? a : a + 1 + ones[set];
+                    unsigned nextSet = d ? set | 1u << (d - 1) : set >> (ones[set] + 1);
+                    size_t index = nextSet * offsets + (c - (int) next + k);
+                    double candidate = value + row[tour[c]];
+                    double &target = slot(next)[index];
+                    if (candidate < target) {
+                        target = candidate;
+                        pred[next * layer + index] = (signed char) (l - (int) next);
+                    }
+                }
+            }
+        }
+    }
+
+    double best = inf;
+    int l = 0;
+    for (int o = 0; o < (int) offsets; o++) {
+        int v = (int) n - k + o;
+        double value = slot(n)[o];
+        if (v < 0 || v >= (int) n || value == inf)
+            continue;
+        value += closure.getDistance(tour[v], tour[0]);
+        if (value < best) {
+            best = value;
+            l = v;
+        }
+    }
+
+    vector<unsigned> order(n);
+    unsigned a = n;
+    unsigned set = 0;
+    for (unsigned p = n - 1; p > 0; p--) {
+        order[p] = l;
+        int previous = (int) a + pred[a * layer + set * offsets + (l - (int) a + k)];
+        if (l > (int) a) {
+            set &= ~(1u << (l - a - 1));
+        } else {
+            set = ((1u << (a - l - 1)) - 1) | set << (a - l);
+            a = l;
+        }
+        l = previous;
+    }
+    order[0] = 0;
+    vector<unsigned> optimized(n);
+    for (unsigned p = 0; p < n; p++)
+        optimized[p] = tour[order[p]];
+    tour = optimized;
+    return best;
+}
@@ -0,0 +1,53 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#ifndef TSP_BALASSIMONETTI_H
+#define TSP_BALASSIMONETTI_H
+
+
+#include <vector>
+#include "MetricClosure.h"
+
+class BalasSimonetti {
+public:
+    /**@brief Construtor com parâmetros. Prepara a pós-otimização de circuitos sobre closure, com janela window.
+     *
+     * Complexidade Temporal: O(1)
+     * @param closure fecho métrico do grafo
+     * @param window janela k: nenhum vértice pode passar à frente de outro que estava k ou mais posições depois dele (entre 2 e 12)
+     */
+    explicit BalasSimonetti(const MetricClosure &closure, unsigned window = 8);
+
+    /**@brief Pós-otimiza o circuito circuit através da programação dinâmica de Balas e Simonetti: determina o circuito de custo mínimo entre todos os que se obtêm reordenando os vértices de modo a que nenhum vértice passe à frente de outro que estava k ou mais posições depois dele.
+     * Cada estado guarda o primeiro vértice ainda não visitado, o conjunto dos vértices visitados na janela seguinte e o último vértice visitado. Como o primeiro vértice fica fixo, a programação dinâmica é repetida com o circuito rodado por metade do seu tamanho, até deixar de melhorar.
+     *
+     * Complexidade Temporal: O(p V k<SUP>2</SUP> 2<SUP>k</SUP>), sendo p o número de passagens, V o número de vértices e k a janela
+     * @throws std::invalid_argument se o circuito não corresponde ao grafo
+     * @param circuit circuito a otimizar (pode repetir vértices, como os circuitos expandidos; só conta a primeira ocorrência de cada vértice), substituído pelo circuito otimizado (começa e acaba no vértice de id 0)
+     * @return custo do circuito depois da otimização (nunca pior do que o do circuito dado)
+     */
+    double optimize(std::vector<unsigned> &circuit) const;
+
+    /**@brief Retorna a janela usada.
+     *
+     * Complexidade Temporal: O(1)
+     * @return janela k
+     */
+    unsigned getWindow() const;
+
+private:
+    const MetricClosure &closure;
+    unsigned window;
+
+    /**@brief Executa uma passagem da programação dinâmica sobre tour, mantendo o primeiro vértice fixo.
+     *
+     * Complexidade Temporal: O(V k<SUP>2</SUP> 2<SUP>k</SUP>), sendo V o número de vértices e k a janela
+     * @param tour circuito (permutação dos vértices, sem repetir o vértice inicial no fim), substituído pelo melhor circuito encontrado
+     * @return custo do circuito encontrado
+     */
+    double pass(std::vector<unsigned> &tour) const;
+};
+
+
+#endif //TSP_BALASSIMONETTI_H
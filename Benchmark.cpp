@@ -0,0 +1,324 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#include "Benchmark.h"
+#include "AntColony.h"
+#include "DatasetLoader.h"
+#include "Decomposition.h"
+#include "DistancePolicy.h"
+#include "LocalSearch.h"
+#include "MemeticSolver.h"
+#include "MemoryProfiler.h"
+#include "MetricSolver.h"
+#include "ResultsLog.h"
+#include "SmallTsp.h"
+#include "TourConstruction.h"
+#include "TourMerging.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+
+#define BENCHMARK_MAX_CLOSURE 5000u
+#define BENCHMARK_GENERATIONS 20
+#define BENCHMARK_ITERATIONS 20
+#define BENCHMARK_RUNS 4
+#define BENCHMARK_CLUSTER_SIZE 200
+#define BENCHMARK_WINDOW 8
+#define BENCHMARK_COST_TOLERANCE 1e-6
+#define BENCHMARK_TIME_TOLERANCE 0.5
+#define BENCHMARK_TIME_SLACK 50
+#define BENCHMARK_MEMORY_TOLERANCE 0.25
+#define BENCHMARK_MEMORY_SLACK 8192
+
+using namespace std;
+
+/**@brief Resolve o Travelling Salesperson Problem (TSP) com os algoritmos especializados na métrica distance: o melhor de Nearest Neighbor e da aproximação triangular, otimizado com 2-opt.
+ *
+ * Complexidade Temporal: O(V<SUP>2</SUP> log(k) + m n), sendo V o número de vértices, k o número de vizinhos, m o número de melhorias e n o tamanho do circuito
+ * @throws std::invalid_argument se o grafo não é conexo
+ * @param distance política de distância
+ * @return custo do circuito encontrado
+ */
+template<class Distance>
+static double metricSolve(const Distance &distance) {
+    vector<unsigned> nearest, tour;
+    double nearestCost = MetricSolver::nearestNeighbor(distance, nearest);
+    MetricSolver::triangular(distance, tour);
+    if (nearestCost < MetricSolver::cost(distance, tour))
+        tour = nearest;
+    double cost = MetricSolver::twoOpt(distance, MetricSolver::nearestNeighbors(distance, 10), tour);
+    if (cost == numeric_limits<double>::infinity())
+        throw invalid_argument("O grafo não é conexo");
+    return cost;
+}
+
+/**@brief Constrói o fecho métrico de graph, verificando que o grafo é conexo.
+ *
+ * Complexidade Temporal: a do fecho métrico
+ * @throws std::invalid_argument se o grafo não é conexo
+ * @param graph grafo
+ * @return fecho métrico do grafo
+ */
+static MetricClosure connectedClosure(const Graph &graph) {
+    MetricClosure closure(graph);
+    if (!closure.isConnected())
+        throw invalid_argument("O grafo não é conexo");
+    return closure;
+}
+
+Benchmark::Benchmark(unsigned seed) : seed(seed) {
+    datasets = {{"", "Toy-Graphs/shipping.csv", true},
+                {"", "Toy-Graphs/stadiums.csv", true},
+                {"", "Toy-Graphs/tourism.csv", true}};
+    for (unsigned n: {25, 50, 75, 100, 200, 300, 400, 500, 600, 700, 800, 900})
+        datasets.push_back({"", "Extra_Fully_Connected_Graphs/edges_" + to_string(n) + ".csv", false});
+    for (char g: {'1', '2', '3'})
+        datasets.push_back({string("Real-world Graphs/graph") + g + "/nodes.csv",
+                            string("Real-world Graphs/graph") + g + "/edges.csv", true});
+
+    unsigned s = seed;
+    algorithms = {
+            {"backtracking", SMALL_TSP_MAX, [](const Graph &graph) {
+                vector<unsigned> circuit;
+                double cost = graph.tspBacktracking(circuit);
+                if (circuit.empty())
+                    throw invalid_argument("O grafo não tem nenhum circuito");
+                return cost;
+            }},
+            {"aproximação triangular", BENCHMARK_MAX_CLOSURE, [](const Graph &graph) {
+                vector<unsigned> circuit;
+                return graph.tspTriangularApproximation(circuit).second;
+            }},
+            {"aproximação triangular e Balas-Simonetti", BENCHMARK_MAX_CLOSURE, [](const Graph &graph) {
+                vector<unsigned> circuit;
+                graph.tspTriangularApproximation(circuit);
+                return graph.tspBalasSimonetti(circuit, BENCHMARK_WINDOW);
+            }},
+            {"heurística (Simulated Annealing)", BENCHMARK_MAX_CLOSURE, [s](const Graph &graph) {
+                vector<unsigned> circuit;
+                return graph.tspHeuristic(circuit, nullptr, nullptr, 0, 0.0, s).second;
+            }},
+            {"heurística (2-opt de melhor melhoria)", BENCHMARK_MAX_CLOSURE, [](const Graph &graph) {
+                vector<unsigned> circuit;
+                return graph.tspBestImprovement(circuit, nullptr, nullptr, 1).second;
+            }},
+            {"Greedy Edge e 2-opt", BENCHMARK_MAX_CLOSURE, [](const Graph &graph) {
+                MetricClosure closure = connectedClosure(graph);
+                vector<unsigned> tour = TourConstruction::greedyEdge(closure);
+                return LocalSearch(closure).twoOpt(tour);
+            }},
+            {"Christofides e 2-opt", BENCHMARK_MAX_CLOSURE, [](const Graph &graph) {
+                MetricClosure closure = connectedClosure(graph);
+                vector<unsigned> tour = graph.tspChristofides(closure);
+                return LocalSearch(closure).twoOpt(tour);
+            }},
+            {"algoritmo memético", BENCHMARK_MAX_CLOSURE, [s](const Graph &graph) {
+                MetricClosure closure = connectedClosure(graph);
+                vector<unsigned> circuit;
+                return MemeticSolver(closure, 30, 1, s).solve(circuit, BENCHMARK_GENERATIONS);
+            }},
+            {"colónia de formigas", BENCHMARK_MAX_CLOSURE, [s](const Graph &graph) {
+                MetricClosure closure = connectedClosure(graph);
+                vector<unsigned> circuit;
+                return AntColony(closure, 25, 1, s).solve(circuit, BENCHMARK_ITERATIONS);
+            }},
+            {"fusão de circuitos", BENCHMARK_MAX_CLOSURE, [s](const Graph &graph) {
+                MetricClosure closure = connectedClosure(graph);
+                TourMerging merging(closure);
+                for (unsigned r = 0; r < BENCHMARK_RUNS; r++) {
+                    vector<unsigned> circuit;
+                    graph.tspHeuristic(closure, circuit, nullptr, nullptr, 0, 0.0, s + r);
+                    merging.add(circuit);
+                }
+                vector<unsigned> circuit;
+                return merging.merge(circuit);
+            }},
+            {"decomposição geográfica", numeric_limits<unsigned>::max(), [s](const Graph &graph) {
+                vector<unsigned> circuit;
+                return Decomposition(graph, BENCHMARK_CLUSTER_SIZE, 1, s).solve(circuit);
+            }},
+            {"algoritmos especializados", numeric_limits<unsigned>::max(), [](const Graph &graph) {
+                if (selectMetric(graph) == DistanceMetric::CSR)
+                    return metricSolve(CsrDistance(graph));
+                return metricSolve(MatrixDistance(connectedClosure(graph)));
+            }}};
+}
+
+vector<Benchmark::Result> Benchmark::run(ostream &out) const {
+    vector<Result> results;
+    for (const Dataset &dataset: datasets) {
+        string name = dataset.nodesFile.empty() ? dataset.edgesFile : dataset.nodesFile + ";" + dataset.edgesFile;
+        Graph graph;
+        long load;
+        {
+            DatasetLoader loader(graph, dataset.nodesFile, dataset.edgesFile, dataset.header, false);
+            if (!loader.wait()) {
+                out << name << ": não foi possível carregar o conjunto de dados." << endl;
+                continue;
+            }
+            load = loader.getMilliseconds();
+        }
+        MemoryProfiler::takePhases();
+        out << name << " (" << graph.size() << " nós, carregado em " << load << " milissegundos):" << endl;
+        for (const Algorithm &algorithm: algorithms) {
+            if (graph.size() > algorithm.maxNodes)
+                continue;
+            double cost;
+            MemoryProfiler::releaseFreeMemory();
+            auto start = chrono::steady_clock::now();
+            try {
+                MemoryProfiler::Scope scope("benchmark");
+                cost = algorithm.solve(graph);
+            } catch (invalid_argument &) {
+                MemoryProfiler::takePhases();
+                out << "  " << algorithm.name << ": não aplicável." << endl;
+                continue;
+            }
+            auto end = chrono::steady_clock::now();
+            MemoryProfiler::Phase phase = MemoryProfiler::takePhases().back();
+            results.push_back({name, algorithm.name, load, (long) ((end - start) / chrono::milliseconds(1)), cost,
+                               phase.bytes, phase.peakRss});
+            out << "  " << algorithm.name << ": custo " << cost << ", " << results.back().solveMilliseconds
+                << " milissegundos, pico de RSS de " << phase.peakRss / 1024 << " MiB." << endl;
+            ResultsLog().append(name, algorithm.name, cost, results.back().solveMilliseconds, graph, {phase});
+        }
+    }
+    return results;
+}
+
+bool Benchmark::write(const string &file, const vector<Result> &results) {
+    ofstream out(file);
+    if (!out)
+        return false;
+    out << "conjunto,algoritmo,carregamento_ms,resolucao_ms,custo,bytes_alocados,pico_rss_kib\n";
+    for (const Result &result: results)
+        out << '"' << result.dataset << "\",\"" << result.algorithm << "\"," << result.loadMilliseconds << ','
+            << result.solveMilliseconds << ',' << setprecision(17) << result.cost << ',' << result.bytes << ','
+            << result.peakRss << '\n';
+    return (bool) out;
+}
+
+bool Benchmark::read(const string &file, vector<Result> &results) {
+    ifstream in(file);
+    if (!in)
+        return false;
+    string line;
+    getline(in, line);
+    while (getline(in, line)) {
+        if (line.empty())
+            continue;
+        vector<string> fields;
+        string field;
+        bool quoted = false;
+        for (char ch: line) {
+            if (ch == '"') {
+                quoted = !quoted;
+            } else if (ch == ',' && !quoted) {
+                fields.push_back(field);
+                field.clear();
+            } else {
+                field += ch;
+            }
+        }
+        fields.push_back(field);
+        if (fields.size() != 7)
+            return false;
+        Result result;
+        result.dataset = fields[0];
+        result.algorithm = fields[1];
+        istringstream values(fields[2] + ' ' + fields[3] + ' ' + fields[4] + ' ' + fields[5] + ' ' + fields[6]);
+        if (!(values >> result.loadMilliseconds >> result.solveMilliseconds >> result.cost >> result.bytes
+                     >> result.peakRss))
+            return false;
+        results.push_back(result);
+    }
+    return true;
+}
+
+unsigned Benchmark::compare(const vector<Result> &baseline, const vector<Result> &results, ostream &out) {
+    map<pair<string, string>, const Result *> reference;
+    for (const Result &result: baseline)
+        reference[make_pair(result.dataset, result.algorithm)] = &result;
+    auto slower = [](double before, double after, double slack) {
+        return after > before * (1.0 + BENCHMARK_TIME_TOLERANCE) + slack;
+    };
+    unsigned regressions = 0;
+    set<pair<string, string>> current;
+    for (const Result &result: results)
+        current.insert(make_pair(result.dataset, result.algorithm));
+    for (const auto &entry: reference)
+        if (current.find(entry.first) == current.end()) {
+            out << "REGRESSÃO de cobertura em " << entry.first.first << " / " << entry.first.second
+                << ": o resultado existe na referência, mas não foi obtido (erro ao carregar ou algoritmo não aplicável)."
+                << endl;
+            regressions++;
+        }
+    set<string> loads;
+    for (const Result &result: results) {
+        auto it = reference.find(make_pair(result.dataset, result.algorithm));
+        if (it == reference.end()) {
+            out << "Sem referência: " << result.dataset << " / " << result.algorithm << "." << endl;
+            continue;
+        }
+        const Result &before = *it->second;
+        string where = result.dataset + " / " + result.algorithm;
+        if (result.cost > before.cost + BENCHMARK_COST_TOLERANCE * max(1.0, fabs(before.cost))) {
+            out << "REGRESSÃO de qualidade em " << where << ": custo " << before.cost << " -> " << result.cost << "."
+                << endl;
+            regressions++;
+        }
+        if (slower(before.solveMilliseconds, result.solveMilliseconds, BENCHMARK_TIME_SLACK)) {
+            out << "REGRESSÃO de tempo em " << where << ": " << before.solveMilliseconds << " -> "
+                << result.solveMilliseconds << " milissegundos." << endl;
+            regressions++;
+        }
+        if (loads.insert(result.dataset).second &&
+            slower(before.loadMilliseconds, result.loadMilliseconds, BENCHMARK_TIME_SLACK)) {
+            out << "REGRESSÃO de tempo de carregamento em " << result.dataset << ": " << before.loadMilliseconds
+                << " -> " << result.loadMilliseconds << " milissegundos." << endl;
+            regressions++;
+        }
+        if (result.peakRss > before.peakRss * (1.0 + BENCHMARK_MEMORY_TOLERANCE) + BENCHMARK_MEMORY_SLACK ||
+            result.bytes > before.bytes * (1.0 + BENCHMARK_MEMORY_TOLERANCE) + BENCHMARK_MEMORY_SLACK * 1024.0) {
+            out << "REGRESSÃO de memória em " << where << ": pico de RSS " << before.peakRss << " -> "
+                << result.peakRss << " KiB, memória alocada " << before.bytes << " -> " << result.bytes << " bytes."
+                << endl;
+            regressions++;
+        }
+    }
+    return regressions;
+}
+
+bool Benchmark::execute(const string &baseline, bool update, ostream &out) const {
+    vector<Result> reference;
+    bool exists = (bool) ifstream(baseline);
+    if (!update && exists && !read(baseline, reference)) {
+        out << "O ficheiro de referência " << baseline
+            << " tem linhas inválidas (use --update para o substituir pelos novos resultados)." << endl;
+        return false;
+    }
+    vector<Result> results = run(out);
+    if (update || !exists) {
+        if (!write(baseline, results)) {
+            out << "\nNão foi possível escrever a referência em " << baseline << "." << endl;
+            return false;
+        }
+        out << "\nA referência foi escrita em " << baseline << " (" << results.size() << " resultados)." << endl;
+        return true;
+    }
+    out << endl;
+    unsigned regressions = compare(reference, results, out);
+    if (regressions)
+        out << "\nForam encontradas " << regressions << " regressões em relação a " << baseline << "." << endl;
+    else
+        out << "Não foram encontradas regressões em relação a " << baseline << "." << endl;
+    return !regressions;
+}
@@ -0,0 +1,102 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#ifndef TSP_BENCHMARK_H
+#define TSP_BENCHMARK_H
+
+
+#include <cstddef>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "Graph.h"
+
+class Benchmark {
+public:
+    /**@brief Resultado de um algoritmo sobre um conjunto de dados.
+     */
+    struct Result {
+        std::string dataset;
+        std::string algorithm;
+        long loadMilliseconds;
+        long solveMilliseconds;
+        double cost;
+        unsigned long long bytes;
+        std::size_t peakRss;
+    };
+
+    /**@brief Construtor com parâmetros. Prepara a execução de todos os algoritmos (exceto o portfólio, que depende do tempo, e o subconjunto, que depende de input) sobre os Toy-Graphs, os 12 Extra_Fully_Connected_Graphs e os 3 Real-world Graphs, com sementes fixas e uma thread por algoritmo, para que os custos sejam reprodutíveis.
+     *
+     * Complexidade Temporal: O(1)
+     * @param seed semente dos algoritmos aleatórios
+     */
+    explicit Benchmark(unsigned seed = 2023);
+
+    /**@brief Executa o benchmark: carrega cada conjunto de dados, executa cada algoritmo aplicável e regista o tempo de carregamento, o tempo de execução, o custo do circuito, a memória alocada e o pico de RSS.
+     *
+     * Complexidade Temporal: a soma das dos algoritmos sobre todos os conjuntos de dados
+     * @param out stream onde é apresentado o progresso
+     * @return resultados, por conjunto de dados e algoritmo
+     */
+    std::vector<Result> run(std::ostream &out) const;
+
+    /**@brief Escreve os resultados results no ficheiro CSV file (por exemplo, para servirem de referência a execuções futuras).
+     *
+     * Complexidade Temporal: O(r), sendo r o número de resultados
+     * @param file caminho do ficheiro
+     * @param results resultados a escrever
+     * @return true se a operação foi bem-sucedida, false caso contrário
+     */
+    static bool write(const std::string &file, const std::vector<Result> &results);
+
+    /**@brief Lê resultados do ficheiro CSV file, escrito por write.
+     *
+     * Complexidade Temporal: O(r), sendo r o número de resultados
+     * @param file caminho do ficheiro
+     * @param results resultados lidos
+     * @return true se a operação foi bem-sucedida, false caso contrário (o ficheiro não existe ou tem linhas inválidas)
+     */
+    static bool read(const std::string &file, std::vector<Result> &results);
+
+    /**@brief Compara os resultados results com os resultados de referência baseline e apresenta as regressões: custo pior (para além de um erro relativo mínimo), tempo de carregamento ou de execução mais lento, ou mais memória (para além das tolerâncias relativa e absoluta). Um resultado da referência que não exista em results (conjunto de dados que deixou de carregar ou algoritmo que deixou de ser aplicável) também é uma regressão.
+     *
+     * Complexidade Temporal: O(r log(b)), sendo r o número de resultados e b o número de resultados de referência
+     * @param baseline resultados de referência
+     * @param results resultados a comparar
+     * @param out stream onde são apresentadas as regressões
+     * @return número de regressões
+     */
+    static unsigned compare(const std::vector<Result> &baseline, const std::vector<Result> &results, std::ostream &out);
+
+    /**@brief Executa o benchmark e compara-o com o ficheiro de referência baseline. Se o ficheiro não existir, ou se update for true, escreve os resultados como nova referência; se existir mas tiver linhas inválidas, falha sem executar o benchmark nem o substituir. Os resultados são também acrescentados ao ficheiro de resultados (ver ResultsLog).
+     *
+     * Complexidade Temporal: a de run
+     * @param baseline caminho do ficheiro de referência
+     * @param update true para substituir a referência pelos resultados, false para comparar
+     * @param out stream onde são apresentados o progresso e as regressões
+     * @return true se não houve regressões, false caso contrário (incluindo referência inválida)
+     */
+    bool execute(const std::string &baseline, bool update, std::ostream &out) const;
+
+private:
+    struct Algorithm {
+        std::string name;
+        unsigned maxNodes;
+        std::function<double(const Graph &)> solve;
+    };
+
+    struct Dataset {
+        std::string nodesFile;
+        std::string edgesFile;
+        bool header;
+    };
+
+    unsigned seed;
+    std::vector<Algorithm> algorithms;
+    std::vector<Dataset> datasets;
+};
+
+
+#endif //TSP_BENCHMARK_H
@@ -0,0 +1,95 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#ifndef TSP_BOUNDEDQUEUE_H
+#define TSP_BOUNDEDQUEUE_H
+
+
+#include <condition_variable>
+#include <mutex>
+#include <queue>
+
+template<class T>
+class BoundedQueue {
+public:
+    /**@brief Construtor com parâmetros. Constrói uma fila com capacidade limitada, partilhada entre threads produtoras e consumidoras.
+     *
+     * Complexidade Temporal: O(1)
+     * @param capacity número máximo de elementos na fila
+     */
+    explicit BoundedQueue(std::size_t capacity);
+
+    /**@brief Insere o elemento x no fim da fila, esperando enquanto a fila estiver cheia.
+     *
+     * Complexidade Temporal: O(1), sem contar com o tempo de espera
+     * @param x elemento a inserir
+     * @return true se o elemento foi inserido, false se a fila foi fechada
+     */
+    bool push(T x);
+
+    /**@brief Retira o primeiro elemento da fila, esperando enquanto a fila estiver vazia e aberta.
+     *
+     * Complexidade Temporal: O(1), sem contar com o tempo de espera
+     * @param x elemento retirado
+     * @return true se foi retirado um elemento, false se a fila está vazia e foi fechada
+     */
+    bool pop(T &x);
+
+    /**@brief Fecha a fila: as inserções seguintes falham e as remoções deixam de esperar quando a fila fica vazia.
+     *
+     * Complexidade Temporal: O(1)
+     */
+    void close();
+
+private:
+    std::size_t capacity;
+    std::queue<T> elements;
+    std::mutex mutex;
+    std::condition_variable notFull;
+    std::condition_variable notEmpty;
+    bool closed = false;
+};
+
+template<class T>
+BoundedQueue<T>::BoundedQueue(std::size_t capacity) : capacity(capacity > 0 ? capacity : 1) {}
+
+template<class T>
+bool BoundedQueue<T>::push(T x) {
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        notFull.wait(lock, [this] { return closed || elements.size() < capacity; });
+        if (closed)
+            return false;
+        elements.push(std::move(x));
+    }
+    notEmpty.notify_one();
+    return true;
+}
+
+template<class T>
+bool BoundedQueue<T>::pop(T &x) {
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        notEmpty.wait(lock, [this] { return closed || !elements.empty(); });
+        if (elements.empty())
+            return false;
+        x = std::move(elements.front());
+        elements.pop();
+    }
+    notFull.notify_one();
+    return true;
+}
+
+template<class T>
+void BoundedQueue<T>::close() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        closed = true;
+    }
+    notFull.notify_all();
+    notEmpty.notify_all();
+}
+
+
+#endif //TSP_BOUNDEDQUEUE_H
@@ -0,0 +1,253 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#include "DatasetLoader.h"
+#include "BoundedQueue.h"
+#include "MemoryProfiler.h"
+#include "TourConstruction.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <thread>
+
+using namespace std;
+
+#define CHUNK_SIZE (1u << 16)
+#define QUEUE_CAPACITY 8u
+
+DatasetLoader::DatasetLoader(Graph &graph, string nodesFile, string edgesFile, bool header, bool hilbert,
+                             unsigned threads)
+        : graph(graph), nodesFile(move(nodesFile)), edgesFile(move(edgesFile)), header(header), hilbert(hilbert),
+          threads(threads ? threads : max(1u, thread::hardware_concurrency())) {
+    for (const string &file: {this->nodesFile, this->edgesFile})
+        if (!file.empty()) {
+            ifstream in("../files/" + file, ios::binary | ios::ate);
+            if (in.is_open())
+                total += (size_t) in.tellg();
+        }
+    result = async(launch::async, &DatasetLoader::load, this);
+}
+
+DatasetLoader::~DatasetLoader() {
+    if (result.valid())
+        result.wait();
+}
+
+bool DatasetLoader::ready() const {
+    return done || result.wait_for(chrono::seconds(0)) == future_status::ready;
+}
+
+double DatasetLoader::getProgress() const {
+    return total ? min(1.0, (double) processed / total) : 1.0;
+}
+
+bool DatasetLoader::wait() {
+    if (!done) {
+        try {
+            success = result.get();
+        } catch (exception &e) {
+            report << "Erro ao carregar os dados: " << e.what() << endl;
+            success = false;
+        }
+        done = true;
+    }
+    return success;
+}
+
+string DatasetLoader::getReport() const {
+    return report.str();
+}
+
+long DatasetLoader::getMilliseconds() const {
+    return milliseconds;
+}
+
+bool DatasetLoader::load() {
+    MemoryProfiler::Scope scope("carregamento");
+    auto start = chrono::steady_clock::now();
+    string contents;
+    bool loaded = true;
+    if (!nodesFile.empty()) {
+        loaded = readFile(nodesFile, contents);
+        if (loaded)
+            readNodes(contents);
+    }
+    if (loaded) {
+        loaded = readFile(edgesFile, contents);
+        if (loaded)
+            readEdges(contents);
+    }
+    milliseconds = (long) ((chrono::steady_clock::now() - start) / chrono::milliseconds(1));
+    return loaded;
+}
+
+void DatasetLoader::readNodes(const string &contents) {
+    size_t begin = contents.find('\n');
+    begin = begin == string::npos ? contents.size() : begin + 1;
+    processed += begin;
+    unsigned errors = 0;
+    pipeline(contents, begin, [this, &errors](const Record &record) {
+        if (!record.valid || record.fields[0] < 0 ||
+            !graph.addVertex((unsigned) record.fields[0], record.fields[1], record.fields[2]))
+            errors++;
+    });
+    report << "Leitura do ficheiro " << nodesFile << " bem-sucedida!" << endl;
+    report << "Foram lidos " << graph.size() << " nós e ocorreram " << errors << " erros." << endl;
+    if (!hilbert)
+        return;
+    auto start = chrono::steady_clock::now();
+    vector<pair<double, double>> points(graph.size());
+    for (unsigned v = 0; v < graph.size(); v++)
+        points[v] = make_pair(graph.findVertex(v)->getLongitude(), graph.findVertex(v)->getLatitude());
+    graph.reorder(TourConstruction::hilbertCurve(points));
+    auto end = chrono::steady_clock::now();
+    double cost = 0.0;
+    for (unsigned v = 0; v < graph.size(); v++)
+        cost += graph.findVertex(v)->calculateDistance(graph.findVertex((v + 1) % graph.size()));
+    report << "Os nós foram reordenados em cerca de " << (end - start) / chrono::milliseconds(1)
+           << " milissegundos (os resultados usam os ids originais)." << endl;
+    report << "O circuito que segue a curva de Hilbert tem custo (distância geográfica) " << cost << "." << endl;
+}
+
+void DatasetLoader::readEdges(const string &contents) {
+    size_t begin = 0;
+    if (header) {
+        begin = contents.find('\n');
+        begin = begin == string::npos ? contents.size() : begin + 1;
+    }
+    processed += begin;
+    bool nodes = !nodesFile.empty();
+    unsigned counter = 0;
+    unsigned errors = 0;
+    pipeline(contents, begin, [this, nodes, &counter, &errors](const Record &record) {
+        if (!record.valid || record.fields[0] < 0 || record.fields[1] < 0) {
+            errors++;
+            return;
+        }
+        unsigned orig = (unsigned) record.fields[0];
+        unsigned dest = (unsigned) record.fields[1];
+        if (nodes) {
+            orig = graph.getInternalId(orig);
+            dest = graph.getInternalId(dest);
+        } else {
+            while (graph.size() <= max(orig, dest))
+                graph.addVertex(graph.size());
+        }
+        if (graph.addEdge(orig, dest, record.fields[2]))
+            counter++;
+        else
+            errors++;
+    });
+    report << "Leitura do ficheiro " << edgesFile << " bem-sucedida!" << endl;
+    if (nodes)
+        report << "Foram lidas " << counter << " arestas e ocorreram " << errors << " erros." << endl;
+    else
+        report << "Foram lidos " << graph.size() << " nós e " << counter << " arestas e ocorreram " << errors
+               << " erros." << endl;
+    if (graph.getDuplicateEdges())
+        report << graph.getDuplicateEdges() << " dos erros são arestas duplicadas (manteve-se a de menor distância)."
+               << endl;
+}
+
+void DatasetLoader::pipeline(const string &contents, size_t begin, const function<void(const Record &)> &build) {
+    vector<size_t> bounds = {begin};
+    while (bounds.back() < contents.size()) {
+        size_t next = contents.find('\n', min(bounds.back() + CHUNK_SIZE, contents.size() - 1));
+        bounds.push_back(next == string::npos ? contents.size() : next + 1);
+    }
+    unsigned chunks = bounds.size() - 1;
+
+    BoundedQueue<Chunk> queue(QUEUE_CAPACITY);
+    atomic<unsigned> next{0};
+    unsigned applied = 0;
+    mutex mutex;
+    condition_variable advanced;
+    vector<thread> parsers;
+    for (unsigned t = 0; t < min(threads, chunks); t++)
+        parsers.emplace_back([&] {
+            for (unsigned c = next++; c < chunks; c = next++) {
+                {
+                    unique_lock<std::mutex> lock(mutex);
+                    advanced.wait(lock, [&] { return c < applied + QUEUE_CAPACITY; });
+                }
+                if (!queue.push(Chunk{c, parse(contents, bounds[c], bounds[c + 1])}))
+                    return;
+            }
+        });
+
+    auto finish = [&] {
+        {
+            lock_guard<std::mutex> lock(mutex);
+            applied = chunks;
+        }
+        advanced.notify_all();
+        queue.close();
+        for (thread &parser: parsers)
+            parser.join();
+    };
+    try {
+        map<unsigned, vector<Record>> pending;
+        Chunk chunk;
+        unsigned expected = 0;
+        while (expected < chunks && queue.pop(chunk)) {
+            pending[chunk.index] = move(chunk.records);
+            for (auto it = pending.find(expected); it != pending.end(); it = pending.find(expected)) {
+                for (const Record &record: it->second)
+                    build(record);
+                processed += bounds[expected + 1] - bounds[expected];
+                pending.erase(it);
+                {
+                    lock_guard<std::mutex> lock(mutex);
+                    applied = ++expected;
+                }
+                advanced.notify_all();
+            }
+        }
+    } catch (...) {
+        finish();
+        throw;
+    }
+    finish();
+}
+
+vector<DatasetLoader::Record> DatasetLoader::parse(const string &contents, size_t begin, size_t end) {
+    vector<Record> records;
+    const char *data = contents.data();
+    while (begin < end) {
+        size_t lineEnd = contents.find('\n', begin);
+        if (lineEnd == string::npos || lineEnd > end)
+            lineEnd = end;
+        const char *p = data + begin;
+        const char *last = data + lineEnd;
+        while (last > p && (last[-1] == '\r' || last[-1] == ' '))
+            last--;
+        if (last > p) {
+            Record record{{0.0, 0.0, 0.0}, true};
+            for (unsigned f = 0; f < 3 && record.valid; f++) {
+                char *stop;
+                record.fields[f] = strtod(p, &stop);
+                if (stop == p || stop > last || (stop < last && *stop != ',') || (stop == last && f < 2))
+                    record.valid = false;
+                p = stop + 1;
+            }
+            records.push_back(record);
+        }
+        begin = lineEnd + 1;
+    }
+    return records;
+}
+
+bool DatasetLoader::readFile(const string &path, string &contents) {
+    ifstream in("../files/" + path, ios::binary);
+    if (!in.is_open()) {
+        report << "Erro ao abrir o ficheiro " << path << "." << endl;
+        report << "Verifique se o ficheiro se encontra dentro do diretório files." << endl;
+        return false;
+    }
+    report << "\nA ler ficheiro " << path << "..." << endl;
+    contents.assign(istreambuf_iterator<char>(in), istreambuf_iterator<char>());
+    return true;
+}
@@ -0,0 +1,156 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#ifndef TSP_DATASETLOADER_H
+#define TSP_DATASETLOADER_H
+
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "Graph.h"
+
+class DatasetLoader {
+public:
+    /**@brief Construtor com parâmetros. Começa a carregar, numa thread em segundo plano, os ficheiros de dados para graph (que deve estar vazio e não pode ser usado até wait retornar).
+     * Cada ficheiro é lido para memória e dividido em blocos de linhas, analisados por várias threads; os blocos analisados passam por uma fila limitada para a thread de carregamento, que cria os nós e as arestas pela ordem do ficheiro.
+     *
+     * Complexidade Temporal: O(1) (o carregamento decorre em segundo plano)
+     * @param graph grafo a preencher
+     * @param nodesFile caminho do ficheiro de nós, relativo ao diretório files (vazio se o ficheiro de arestas define o grafo sozinho)
+     * @param edgesFile caminho do ficheiro de arestas, relativo ao diretório files
+     * @param header true se a primeira linha do ficheiro de arestas é um cabeçalho (a do ficheiro de nós é sempre), false caso contrário
+     * @param hilbert true para reordenar os nós ao longo de uma curva de Hilbert antes de ler as arestas, false caso contrário
+     * @param threads número de threads para a análise dos blocos (se 0, usa o número de threads suportadas pelo hardware)
+     */
+    DatasetLoader(Graph &graph, std::string nodesFile, std::string edgesFile, bool header, bool hilbert,
+                  unsigned threads = 0);
+
+    /**@brief Destrutor. Espera que o carregamento termine.
+     *
+     * Complexidade Temporal: a do carregamento que ainda falte
+     */
+    ~DatasetLoader();
+
+    DatasetLoader(const DatasetLoader &) = delete;
+
+    DatasetLoader &operator=(const DatasetLoader &) = delete;
+
+    /**@brief Indica se o carregamento já terminou.
+     *
+     * Complexidade Temporal: O(1)
+     * @return true se o carregamento terminou, false caso contrário
+     */
+    bool ready() const;
+
+    /**@brief Retorna a fração dos ficheiros de dados já carregada para o grafo.
+     *
+     * Complexidade Temporal: O(1)
+     * @return fração carregada, entre 0 e 1
+     */
+    double getProgress() const;
+
+    /**@brief Espera que o carregamento termine.
+     *
+     * Complexidade Temporal: a do carregamento que ainda falte
+     * @return true se todos os ficheiros foram lidos com sucesso, false caso contrário
+     */
+    bool wait();
+
+    /**@brief Retorna o relatório do carregamento (ficheiros lidos, número de nós e de arestas, erros), depois de wait retornar.
+     *
+     * Complexidade Temporal: O(1)
+     * @return relatório do carregamento
+     */
+    std::string getReport() const;
+
+    /**@brief Retorna o tempo que o carregamento demorou, em milissegundos, depois de wait retornar.
+     *
+     * Complexidade Temporal: O(1)
+     * @return tempo do carregamento, em milissegundos
+     */
+    long getMilliseconds() const;
+
+private:
+    struct Record {
+        double fields[3];
+        bool valid;
+    };
+
+    struct Chunk {
+        unsigned index;
+        std::vector<Record> records;
+    };
+
+    Graph &graph;
+    std::string nodesFile;
+    std::string edgesFile;
+    bool header;
+    bool hilbert;
+    unsigned threads;
+    std::size_t total = 0;
+    std::atomic<std::size_t> processed{0};
+    std::ostringstream report;
+    long milliseconds = 0;
+    std::future<bool> result;
+    bool success = false;
+    bool done = false;
+
+    /**@brief Carrega os ficheiros de dados (executado em segundo plano).
+     *
+     * Complexidade Temporal: O(n), sendo n o número de linhas dos ficheiros de dados (sem contar com a inserção das arestas no grafo)
+     * @return true se todos os ficheiros foram lidos com sucesso, false caso contrário
+     */
+    bool load();
+
+    /**@brief Lê o ficheiro de nós e cria os nós do grafo (e, se pedido, reordena-os ao longo de uma curva de Hilbert).
+     *
+     * Complexidade Temporal: O(n), sendo n o número de linhas do ficheiro de nós
+     * @param contents conteúdo do ficheiro de nós
+     */
+    void readNodes(const std::string &contents);
+
+    /**@brief Lê o ficheiro de arestas e preenche o grafo com as arestas (criando os nós que faltem, se não houver ficheiro de nós).
+     *
+     * Complexidade Temporal: O(n), sendo n o número de linhas do ficheiro de arestas
+     * @param contents conteúdo do ficheiro de arestas
+     */
+    void readEdges(const std::string &contents);
+
+    /**@brief Analisa em paralelo os blocos de linhas de contents, a partir da posição begin, e aplica build a cada linha, pela ordem do ficheiro, na thread atual. As threads de análise só avançam até QUEUE_CAPACITY blocos à frente do último bloco aplicado.
+     *
+     * Complexidade Temporal: O(n / T + b), sendo n o tamanho do conteúdo, T o número de threads e b o custo de build para todas as linhas
+     * @param contents conteúdo do ficheiro
+     * @param begin posição onde começam os dados (depois do cabeçalho)
+     * @param build função aplicada a cada linha
+     */
+    void pipeline(const std::string &contents, std::size_t begin, const std::function<void(const Record &)> &build);
+
+    /**@brief Analisa as linhas de contents entre as posições begin e end: cada linha tem até três campos numéricos separados por vírgulas (os restantes campos são ignorados).
+     *
+     * Complexidade Temporal: O(end - begin)
+     * @param contents conteúdo do ficheiro
+     * @param begin posição inicial
+     * @param end posição final
+     * @return linhas analisadas
+     */
+    static std::vector<Record> parse(const std::string &contents, std::size_t begin, std::size_t end);
+
+    /**@brief Lê o ficheiro path, relativo ao diretório files, para contents.
+     *
+     * Complexidade Temporal: O(n), sendo n o tamanho do ficheiro
+     * @param path caminho do ficheiro
+     * @param contents conteúdo do ficheiro
+     * @return true se o ficheiro foi lido, false caso contrário
+     */
+    bool readFile(const std::string &path, std::string &contents);
+};
+
+
+#endif //TSP_DATASETLOADER_H
@@ -0,0 +1,266 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#include "Decomposition.h"
+#include "LocalSearch.h"
+#include "SubInstance.h"
+#include "ThreadPool.h"
+#include "TourConstruction.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+using namespace std;
+
+#define KMEANS_ITERATIONS 10
+#define REPAIR_RADIUS 50u
+
+Decomposition::Decomposition(const Graph &graph, unsigned clusterSize, unsigned threads, unsigned seed) : graph(graph),
+                                                                                                         clusterSize(max(4u, clusterSize)),
+                                                                                                         threads(threads),
+                                                                                                         seed(seed) {}
+
+double Decomposition::solve(vector<unsigned> &circuit) {
+    unsigned n = graph.size();
+    bool coordinates = false;
+    for (unsigned v = 0; v < n && !coordinates; v++)
+        coordinates = graph.findVertex(v)->getLatitude() != 0.0 || graph.findVertex(v)->getLongitude() != 0.0;
+    if (!coordinates)
+        throw invalid_argument("Coordenadas inválidas");
+
+    double meanLatitude = 0.0;
+    for (unsigned v = 0; v < n; v++)
+        meanLatitude += graph.findVertex(v)->getLatitude() / n;
+    double cosine = cos(meanLatitude * M_PI / 180.0);
+    vector<pair<double, double>> points(n);
+    for (unsigned v = 0; v < n; v++)
+        points[v] = make_pair(graph.findVertex(v)->getLongitude() * cosine, graph.findVertex(v)->getLatitude());
+
+    ThreadPool pool(threads);
+    unsigned k = max(1u, (n + clusterSize - 1) / clusterSize);
+    vector<pair<double, double>> centroids;
+    vector<unsigned> assignment = kMeans(k, points, pool, centroids);
+    vector<vector<unsigned>> members(k);
+    for (unsigned v = 0; v < n; v++)
+        members[assignment[v]].push_back(v);
+    vector<unsigned> used;
+    for (unsigned c = 0; c < k; c++)
+        if (!members[c].empty())
+            used.push_back(c);
+    clusters = used.size();
+
+    vector<vector<unsigned>> subTours(k);
+    for (unsigned c: used)
+        pool.submit([this, c, &members, &subTours] {
+            const vector<unsigned> &vertices = members[c];
+            unsigned m = vertices.size();
+            SubInstance subset(graph, vertices);
+            vector<double> distances((size_t) m * m);
+            for (unsigned i = 0; i < m; i++) {
+                const double *row = subset.getRow(i);
+                copy(row, row + m, distances.begin() + (long) ((size_t) i * m));
+            }
+            MetricClosure closure(m, move(distances));
+            mt19937 rng(seed + c);
+            vector<unsigned> local = TourConstruction::nearestNeighbor(closure, 0, rng);
+            LocalSearch(closure).twoOpt(local);
+            for (unsigned &v: local)
+                v = vertices[v];
+            subTours[c] = move(local);
+        });
+    pool.wait();
+
+    unsigned u = used.size();
+    vector<double> centroidDistances((size_t) u * u, 0.0);
+    for (unsigned i = 0; i < u; i++)
+        for (unsigned j = 0; j < u; j++)
+            centroidDistances[(size_t) i * u + j] = hypot(centroids[used[i]].first - centroids[used[j]].first,
+                                                          centroids[used[i]].second - centroids[used[j]].second);
+    MetricClosure centroidClosure(u, move(centroidDistances));
+    mt19937 rng(seed);
+    vector<unsigned> order = TourConstruction::nearestNeighbor(centroidClosure, 0, rng);
+    LocalSearch(centroidClosure).twoOpt(order);
+
+    vector<unsigned> tour;
+    tour.reserve(n);
+    vector<unsigned> junctions;
+    for (unsigned idx = 0; idx < u; idx++) {
+        const vector<unsigned> &cycle = subTours[used[order[idx]]];
+        unsigned m = cycle.size();
+        unsigned entry = 0;
+        if (!tour.empty()) {
+            vector<unsigned> candidates(1, tour.back());
+            candidates.insert(candidates.end(), cycle.begin(), cycle.end());
+            SubInstance subset(graph, candidates);
+            const double *row = subset.getRow(0);
+            double best = numeric_limits<double>::infinity();
+            for (unsigned j = 0; j < m; j++) {
+                double d = row[j + 1];
+                if (d < best) {
+                    best = d;
+                    entry = j;
+                }
+            }
+        }
+        const pair<double, double> &following = centroids[used[order[(idx + 1) % u]]];
+        auto projected = [&](unsigned v) {
+            return hypot(points[v].first - following.first, points[v].second - following.second);
+        };
+        bool forward = projected(cycle[(entry + m - 1) % m]) <= projected(cycle[(entry + 1) % m]);
+        junctions.push_back(tour.size());
+        for (unsigned j = 0; j < m; j++)
+            tour.push_back(cycle[forward ? (entry + j) % m : (entry + m - j) % m]);
+    }
+
+    stitchedCost = walk(TourConstruction::toCircuit(tour), circuit);
+
+    if (n > 8) {
+        unsigned radius = min(REPAIR_RADIUS, (n - 1) / 2 - 1);
+        vector<unsigned> pending = junctions;
+        while (!pending.empty()) {
+            vector<unsigned> deferred;
+            long lastEnd = numeric_limits<long>::min();
+            long firstStart = numeric_limits<long>::max();
+            for (unsigned center: pending) {
+                long start = (long) center - radius;
+                long end = (long) center + radius;
+                if (start <= lastEnd || end - (long) n >= firstStart) {
+                    deferred.push_back(center);
+                    continue;
+                }
+                firstStart = min(firstStart, start);
+                lastEnd = end;
+                pool.submit([this, &tour, center, radius] { repairWindow(tour, center, radius); });
+            }
+            pool.wait();
+            pending = deferred;
+        }
+    }
+
+    return walk(TourConstruction::toCircuit(tour), circuit);
+}
+
+unsigned Decomposition::getClusters() const {
+    return clusters;
+}
+
+double Decomposition::getStitchedCost() const {
+    return stitchedCost;
+}
+
+double Decomposition::walk(const vector<unsigned> &stops, vector<unsigned> &circuit) const {
+    vector<unsigned> every(graph.size());
+    iota(every.begin(), every.end(), 0u);
+    SubInstance all(graph, every);
+    double cost = 0.0;
+    circuit.assign(1, stops[0]);
+    for (unsigned i = 0; i + 1 < stops.size(); i++) {
+        double distance = all.getPath(stops[i], stops[i + 1], circuit);
+        if (distance == numeric_limits<double>::infinity())
+            throw invalid_argument("O grafo não é conexo");
+        cost += distance;
+    }
+    return cost;
+}
+
+vector<unsigned> Decomposition::kMeans(unsigned k, const vector<pair<double, double>> &points, ThreadPool &pool,
+                                       vector<pair<double, double>> &centroids) const {
+    unsigned n = points.size();
+    mt19937 rng(seed);
+    vector<unsigned> sample(n);
+    for (unsigned v = 0; v < n; v++)
+        sample[v] = v;
+    shuffle(sample.begin(), sample.end(), rng);
+    centroids.resize(k);
+    for (unsigned c = 0; c < k; c++)
+        centroids[c] = points[sample[c % n]];
+
+    vector<unsigned> assignment(n, 0);
+    unsigned chunks = pool.size();
+    for (unsigned iteration = 0; iteration < KMEANS_ITERATIONS; iteration++) {
+        for (unsigned t = 0; t < chunks; t++)
+            pool.submit([t, chunks, n, k, &points, &centroids, &assignment] {
+                for (unsigned v = t; v < n; v += chunks) {
+                    double best = numeric_limits<double>::infinity();
+                    for (unsigned c = 0; c < k; c++) {
+                        double dx = points[v].first - centroids[c].first;
+                        double dy = points[v].second - centroids[c].second;
+                        if (dx * dx + dy * dy < best) {
+                            best = dx * dx + dy * dy;
+                            assignment[v] = c;
+                        }
+                    }
+                }
+            });
+        pool.wait();
+
+        vector<pair<double, double>> sums(k, make_pair(0.0, 0.0));
+        vector<unsigned> counts(k, 0);
+        for (unsigned v = 0; v < n; v++) {
+            sums[assignment[v]].first += points[v].first;
+            sums[assignment[v]].second += points[v].second;
+            counts[assignment[v]]++;
+        }
+        for (unsigned c = 0; c < k; c++)
+            centroids[c] = counts[c] ? make_pair(sums[c].first / counts[c], sums[c].second / counts[c])
+                                     : points[uniform_int_distribution<unsigned>(0, n - 1)(rng)];
+    }
+    return assignment;
+}
+
+void Decomposition::repairWindow(vector<unsigned> &tour, unsigned center, unsigned radius) const {
+    unsigned n = tour.size();
+    unsigned m = 2 * radius + 1;
+    unsigned first = (center + n - radius) % n;
+    vector<unsigned> vertices(m);
+    for (unsigned i = 0; i < m; i++)
+        vertices[i] = tour[(first + i) % n];
+    SubInstance subset(graph, vertices);
+    auto distance = [&subset](unsigned i, unsigned j) {
+        return subset.getDistance(i, j);
+    };
+    vector<unsigned> window(m);
+    iota(window.begin(), window.end(), 0u);
+
+    bool improved = true;
+    while (improved) {
+        improved = false;
+        for (unsigned i = 0; i + 3 < m && !improved; i++)
+            for (unsigned j = i + 2; j + 1 < m && !improved; j++) {
+                double gain = distance(window[i], window[i + 1]) + distance(window[j], window[j + 1])
+                              - distance(window[i], window[j]) - distance(window[i + 1], window[j + 1]);
+                if (gain > 1e-9) {
+                    reverse(window.begin() + i + 1, window.begin() + j + 1);
+                    improved = true;
+                }
+            }
+        for (unsigned length = 1; length <= 3 && !improved; length++)
+            for (unsigned s = 1; s + length < m && !improved; s++) {
+                unsigned e = s + length - 1;
+                double removal = distance(window[s - 1], window[s]) + distance(window[e], window[e + 1])
+                                 - distance(window[s - 1], window[e + 1]);
+                for (unsigned t = 0; t + 1 < m && !improved; t++) {
+                    if (t + 1 >= s && t <= e)
+                        continue;
+                    double keep = distance(window[t], window[t + 1]);
+                    double straight = distance(window[t], window[s]) + distance(window[e], window[t + 1]) - keep;
+                    double reversed = distance(window[t], window[e]) + distance(window[s], window[t + 1]) - keep;
+                    if (removal - min(straight, reversed) > 1e-9) {
+                        vector<unsigned> segment(window.begin() + s, window.begin() + e + 1);
+                        if (reversed < straight)
+                            reverse(segment.begin(), segment.end());
+                        window.erase(window.begin() + s, window.begin() + e + 1);
+                        unsigned insert = t < s ? t + 1 : t + 1 - length;
+                        window.insert(window.begin() + insert, segment.begin(), segment.end());
+                        improved = true;
+                    }
+                }
+            }
+    }
+
+    for (unsigned i = 0; i < m; i++)
+        tour[(first + i) % n] = vertices[window[i]];
+}
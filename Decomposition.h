@@ -0,0 +1,93 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#ifndef TSP_DECOMPOSITION_H
+#define TSP_DECOMPOSITION_H
+
+
+#include <random>
+#include <vector>
+#include "Graph.h"
+
+class ThreadPool;
+
+class Decomposition {
+public:
+    /**@brief Construtor com parâmetros. Prepara a resolução do Travelling Salesperson Problem (TSP) por decomposição geográfica de graph, para instâncias demasiado grandes para materializar o fecho métrico completo.
+     *
+     * Complexidade Temporal: O(1)
+     * @param graph grafo a analisar (os vértices têm de ter coordenadas)
+     * @param clusterSize número médio de vértices por grupo
+     * @param threads número de threads a usar (se 0, usa o número de threads suportadas pelo hardware)
+     * @param seed semente do gerador de números aleatórios
+     */
+    Decomposition(const Graph &graph, unsigned clusterSize = 200, unsigned threads = 0,
+                  unsigned seed = std::random_device()());
+
+    /**@brief Resolve (de forma aproximada) o Travelling Salesperson Problem (TSP): agrupa os vértices pelas coordenadas com k-means, resolve o circuito de cada grupo em paralelo (Nearest Neighbor e 2-opt), liga os circuitos dos grupos pela ordem de um circuito sobre os centróides e repara as fronteiras com 2-opt e Or-opt locais.
+     * As coordenadas só são usadas para formar os grupos: os custos são as distâncias das arestas (ou dos caminhos mais curtos, obtidos com SubInstance, se o grafo não for completo) e o circuito é expandido para usar apenas arestas do grafo.
+     *
+     * Complexidade Temporal: O(V k I / T + V c D / T), sendo V o número de vértices, k o número de grupos, I o número de iterações do k-means, c o tamanho dos grupos, T o número de threads e D o custo de cada pesquisa de caminhos mais curtos (O(1) se o grafo for completo)
+     * @throws std::invalid_argument se os vértices do grafo não têm coordenadas ou o grafo não é conexo
+     * @param circuit circuito encontrado (começa e acaba no vértice de id 0; inclui os vértices intermédios dos caminhos mais curtos se o grafo não for completo)
+     * @return custo do circuito encontrado
+     */
+    double solve(std::vector<unsigned> &circuit);
+
+    /**@brief Retorna o número de grupos usados na última resolução.
+     *
+     * Complexidade Temporal: O(1)
+     * @return número de grupos
+     */
+    unsigned getClusters() const;
+
+    /**@brief Retorna o custo do circuito da última resolução antes da reparação das fronteiras.
+     *
+     * Complexidade Temporal: O(1)
+     * @return custo do circuito antes da reparação das fronteiras
+     */
+    double getStitchedCost() const;
+
+private:
+    const Graph &graph;
+    unsigned clusterSize;
+    unsigned threads;
+    unsigned seed;
+    unsigned clusters = 0;
+    double stitchedCost = 0.0;
+
+    /**@brief Calcula o custo do circuito stops e expande-o em circuit, ligando cada par de vértices consecutivos pela aresta entre eles (se o grafo for completo) ou pelo caminho mais curto.
+     *
+     * Complexidade Temporal: O(V D), sendo V o número de vértices e D o custo de cada pesquisa de caminhos mais curtos (O(1) se o grafo for completo)
+     * @throws std::invalid_argument se algum par de vértices consecutivos não está ligado
+     * @param stops circuito (começa e acaba no mesmo vértice)
+     * @param circuit circuito expandido
+     * @return custo do circuito
+     */
+    double walk(const std::vector<unsigned> &stops, std::vector<unsigned> &circuit) const;
+
+    /**@brief Agrupa os vértices em k grupos através do algoritmo k-means sobre uma projeção plana das coordenadas, com a atribuição dos vértices aos centróides feita em paralelo.
+     *
+     * Complexidade Temporal: O(V k I / T), sendo V o número de vértices, k o número de grupos, I o número de iterações e T o número de threads
+     * @param k número de grupos
+     * @param points coordenadas (projeção plana) de cada vértice
+     * @param pool conjunto de threads
+     * @param centroids centróides (projeção plana) determinados para cada grupo
+     * @return grupo atribuído a cada vértice
+     */
+    std::vector<unsigned> kMeans(unsigned k, const std::vector<std::pair<double, double>> &points, ThreadPool &pool,
+                                 std::vector<std::pair<double, double>> &centroids) const;
+
+    /**@brief Otimiza localmente a janela do circuito tour com centro na posição center (2-opt e Or-opt com extremos fixos), para reparar a fronteira entre dois grupos.
+     *
+     * Complexidade Temporal: O(m W<SUP>2</SUP>), sendo W o tamanho da janela e m o número de melhorias
+     * @param tour circuito
+     * @param center posição central da janela
+     * @param radius número de posições da janela para cada lado do centro
+     */
+    void repairWindow(std::vector<unsigned> &tour, unsigned center, unsigned radius) const;
+};
+
+
+#endif //TSP_DECOMPOSITION_H
@@ -0,0 +1,85 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#include "DistancePolicy.h"
+#include "Graph.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+
+#define DEGREES_TO_RADIANS (3.1416 / 180)
+
+DistanceMetric selectMetric(const Graph &graph, bool geometric) {
+    if (geometric) {
+        bool coordinates = false, geographic = true;
+        for (unsigned v = 0; v < graph.size(); v++) {
+            const Vertex *vertex = graph.findVertex(v);
+            if (vertex->getLatitude() != 0.0 || vertex->getLongitude() != 0.0)
+                coordinates = true;
+            if (fabs(vertex->getLatitude()) > 90.0 || fabs(vertex->getLongitude()) > 180.0)
+                geographic = false;
+        }
+        if (coordinates)
+            return geographic ? DistanceMetric::HAVERSINE : DistanceMetric::EUCLIDEAN;
+    }
+    return graph.isComplete() ? DistanceMetric::CSR : DistanceMetric::MATRIX;
+}
+
+string metricName(DistanceMetric metric) {
+    switch (metric) {
+        case DistanceMetric::MATRIX:
+            return "matriz densa (fecho métrico)";
+        case DistanceMetric::HAVERSINE:
+            return "haversine (coordenadas geográficas)";
+        case DistanceMetric::EUCLIDEAN:
+            return "euclidiana (coordenadas planas)";
+        default:
+            return "CSR (arestas do grafo)";
+    }
+}
+
+HaversineDistance::HaversineDistance(const Graph &graph) {
+    unsigned n = graph.size();
+    latitudes.resize(n);
+    longitudes.resize(n);
+    cosines.resize(n);
+    for (unsigned v = 0; v < n; v++) {
+        const Vertex *vertex = graph.findVertex(v);
+        latitudes[v] = vertex->getLatitude() * DEGREES_TO_RADIANS;
+        longitudes[v] = vertex->getLongitude() * DEGREES_TO_RADIANS;
+        cosines[v] = cos(latitudes[v]);
+    }
+}
+
+EuclideanDistance::EuclideanDistance(const Graph &graph) {
+    unsigned n = graph.size();
+    xs.resize(n);
+    ys.resize(n);
+    for (unsigned v = 0; v < n; v++) {
+        xs[v] = graph.findVertex(v)->getLongitude();
+        ys[v] = graph.findVertex(v)->getLatitude();
+    }
+}
+
+CsrDistance::CsrDistance(const Graph &graph) {
+    unsigned n = graph.size();
+    offsets.assign(n + 1, 0);
+    vector<pair<unsigned, double>> row;
+    for (unsigned v = 0; v < n; v++) {
+        row.clear();
+        for (const Edge *edge: graph.findVertex(v)->getAdj())
+            if (edge->getDest()->getId() != v)
+                row.emplace_back(edge->getDest()->getId(), edge->getDistance());
+        sort(row.begin(), row.end());
+        row.erase(unique(row.begin(), row.end(), [](const pair<unsigned, double> &a, const pair<unsigned, double> &b) {
+            return a.first == b.first;
+        }), row.end());
+        for (const auto &edge: row) {
+            targets.push_back(edge.first);
+            distances.push_back(edge.second);
+        }
+        offsets[v + 1] = targets.size();
+    }
+}
@@ -0,0 +1,196 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#ifndef TSP_DISTANCEPOLICY_H
+#define TSP_DISTANCEPOLICY_H
+
+
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+#include "MetricClosure.h"
+
+class Graph;
+
+/**@brief Métricas de distância disponíveis para os algoritmos especializados em tempo de compilação (ver MetricSolver).
+ */
+enum class DistanceMetric {
+    MATRIX, HAVERSINE, EUCLIDEAN, CSR
+};
+
+/**@brief Escolhe a métrica de distância mais adequada para graph. Por omissão, usa os pesos das arestas, como os restantes algoritmos: CSR se o grafo é completo e matriz densa (fecho métrico) caso contrário. Se geometric for true e os vértices tiverem coordenadas, usa a distância entre as coordenadas (o que resolve outra instância): haversine se todas as coordenadas forem geográficas válidas e euclidiana (coordenadas planas) caso contrário.
+ *
+ * Complexidade Temporal: O(V), sendo V o número de vértices do grafo
+ * @param graph grafo
+ * @param geometric true para usar a distância entre as coordenadas dos vértices, se existirem
+ * @return métrica de distância escolhida
+ */
+DistanceMetric selectMetric(const Graph &graph, bool geometric = false);
+
+/**@brief Retorna o nome da métrica de distância metric.
+ *
+ * Complexidade Temporal: O(1)
+ * @param metric métrica de distância
+ * @return nome da métrica
+ */
+std::string metricName(DistanceMetric metric);
+
+class MatrixDistance {
+public:
+    /**@brief Construtor com parâmetros. Política de distância que lê a matriz densa do fecho métrico closure.
+     *
+     * Complexidade Temporal: O(1)
+     * @param closure fecho métrico do grafo
+     */
+    explicit MatrixDistance(const MetricClosure &closure) : closure(closure) {}
+
+    /**@brief Retorna o número de vértices.
+     *
+     * Complexidade Temporal: O(1)
+     * @return número de vértices
+     */
+    unsigned size() const {
+        return closure.size();
+    }
+
+    /**@brief Retorna a distância entre os vértices de id orig e dest.
+     *
+     * Complexidade Temporal: O(1)
+     * @param orig id do vértice de origem
+     * @param dest id do vértice de destino
+     * @return distância entre os vértices
+     */
+    double operator()(unsigned orig, unsigned dest) const {
+        return closure.getDistance(orig, dest);
+    }
+
+private:
+    const MetricClosure &closure;
+};
+
+class HaversineDistance {
+public:
+    /**@brief Construtor com parâmetros. Política de distância geográfica (fórmula de haversine) entre as coordenadas dos vértices de graph, convertidas para radianos uma única vez.
+     *
+     * Complexidade Temporal: O(V), sendo V o número de vértices do grafo
+     * @param graph grafo
+     */
+    explicit HaversineDistance(const Graph &graph);
+
+    /**@brief Retorna o número de vértices.
+     *
+     * Complexidade Temporal: O(1)
+     * @return número de vértices
+     */
+    unsigned size() const {
+        return latitudes.size();
+    }
+
+    /**@brief Retorna a distância geográfica, em metros, entre os vértices de id orig e dest (igual a Vertex::calculateDistance).
+     *
+     * Complexidade Temporal: O(1)
+     * @param orig id do vértice de origem
+     * @param dest id do vértice de destino
+     * @return distância entre os vértices
+     */
+    double operator()(unsigned orig, unsigned dest) const {
+        double dLat = std::sin(0.5 * (latitudes[dest] - latitudes[orig]));
+        double dLon = std::sin(0.5 * (longitudes[dest] - longitudes[orig]));
+        double aux = dLat * dLat + cosines[orig] * cosines[dest] * dLon * dLon;
+        return 2.0 * 6371000 * std::atan2(std::sqrt(aux), std::sqrt(1.0 - aux));
+    }
+
+private:
+    std::vector<double> latitudes;
+    std::vector<double> longitudes;
+    std::vector<double> cosines;
+};
+
+class EuclideanDistance {
+public:
+    /**@brief Construtor com parâmetros. Política de distância euclidiana entre as coordenadas planas (longitude como x e latitude como y) dos vértices de graph.
+     *
+     * Complexidade Temporal: O(V), sendo V o número de vértices do grafo
+     * @param graph grafo
+     */
+    explicit EuclideanDistance(const Graph &graph);
+
+    /**@brief Retorna o número de vértices.
+     *
+     * Complexidade Temporal: O(1)
+     * @return número de vértices
+     */
+    unsigned size() const {
+        return xs.size();
+    }
+
+    /**@brief Retorna a distância euclidiana entre os vértices de id orig e dest.
+     *
+     * Complexidade Temporal: O(1)
+     * @param orig id do vértice de origem
+     * @param dest id do vértice de destino
+     * @return distância entre os vértices
+     */
+    double operator()(unsigned orig, unsigned dest) const {
+        double dx = xs[dest] - xs[orig];
+        double dy = ys[dest] - ys[orig];
+        return std::sqrt(dx * dx + dy * dy);
+    }
+
+private:
+    std::vector<double> xs;
+    std::vector<double> ys;
+};
+
+class CsrDistance {
+public:
+    /**@brief Construtor com parâmetros. Política de distância que lê as arestas de graph num formato compacto (Compressed Sparse Row): para cada vértice, os destinos e as distâncias das suas arestas, ordenados por destino.
+     *
+     * Complexidade Temporal: O(V + E log(E / V)), sendo V o número de vértices e E o número de arestas do grafo
+     * @param graph grafo
+     */
+    explicit CsrDistance(const Graph &graph);
+
+    /**@brief Retorna o número de vértices.
+     *
+     * Complexidade Temporal: O(1)
+     * @return número de vértices
+     */
+    unsigned size() const {
+        return offsets.size() - 1;
+    }
+
+    /**@brief Retorna a distância da aresta entre os vértices de id orig e dest. Se o vértice orig estiver ligado a todos os outros, a posição da aresta é calculada diretamente; caso contrário, é procurada por pesquisa binária.
+     *
+     * Complexidade Temporal: O(1) se o vértice orig estiver ligado a todos os outros, O(log(d)) caso contrário, sendo d o grau do vértice
+     * @param orig id do vértice de origem
+     * @param dest id do vértice de destino
+     * @return distância da aresta (0 se orig e dest forem iguais, infinito se não existir aresta)
+     */
+    double operator()(unsigned orig, unsigned dest) const {
+        if (orig == dest)
+            return 0.0;
+        std::size_t begin = offsets[orig], end = offsets[orig + 1];
+        if (end - begin + 1 == size())
+            return distances[begin + (dest < orig ? dest : dest - 1)];
+        while (begin < end) {
+            std::size_t middle = begin + (end - begin) / 2;
+            if (targets[middle] < dest)
+                begin = middle + 1;
+            else
+                end = middle;
+        }
+        return begin < offsets[orig + 1] && targets[begin] == dest ? distances[begin]
+                                                                  : std::numeric_limits<double>::infinity();
+    }
+
+private:
+    std::vector<std::size_t> offsets;
+    std::vector<unsigned> targets;
+    std::vector<double> distances;
+};
+
+
+#endif //TSP_DISTANCEPOLICY_H
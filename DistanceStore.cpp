@@ -0,0 +1,202 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#include "DistanceStore.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <stdexcept>
+
+#define INT32_DEFAULT_SCALE 0.001
+#define QUANTIZED16_DEFAULT_SCALE (1.0 / 64.0)
+
+using namespace std;
+
+constexpr uint32_t DistanceStore::INT32_MISSING;
+constexpr uint16_t DistanceStore::QUANTIZED16_MISSING;
+
+/**@brief Lê uma aresta (origem, destino, distância) de uma linha de um ficheiro CSV.
+ *
+ * Complexidade Temporal: O(n), sendo n o comprimento da linha
+ * @param line linha do ficheiro
+ * @param orig id do vértice de origem
+ * @param dest id do vértice de destino
+ * @param distance distância da aresta
+ * @return true se a linha é válida, false caso contrário
+ */
+static bool parseEdge(const string &line, unsigned &orig, unsigned &dest, double &distance) {
+    const char *begin = line.c_str();
+    char *end;
+    double fields[3];
+    for (double &field: fields) {
+        field = strtod(begin, &end);
+        if (end == begin)
+            return false;
+        begin = end + (*end == ',' ? 1 : 0);
+    }
+    if (fields[0] < 0 || fields[1] < 0)
+        return false;
+    orig = (unsigned) fields[0];
+    dest = (unsigned) fields[1];
+    distance = fields[2];
+    return true;
+}
+
+DistanceStore::DistanceStore(DistanceEncoding encoding, double scale) : encoding(encoding), scale(scale) {
+    if (encoding == DistanceEncoding::DOUBLE)
+        this->scale = 0.0;
+    else if (scale <= 0.0)
+        this->scale = encoding == DistanceEncoding::INT32 ? INT32_DEFAULT_SCALE : QUANTIZED16_DEFAULT_SCALE;
+    maxError = 0.5 * this->scale;
+}
+
+void DistanceStore::resize(unsigned vertices) {
+    if (vertices <= n)
+        return;
+    n = vertices;
+    size_t count = (size_t) n * (n - 1) / 2;
+    if (encoding == DistanceEncoding::DOUBLE)
+        doubles.resize(count, numeric_limits<double>::infinity());
+    else if (encoding == DistanceEncoding::INT32)
+        ints.resize(count, INT32_MISSING);
+    else
+        shorts.resize(count, QUANTIZED16_MISSING);
+}
+
+bool DistanceStore::set(unsigned orig, unsigned dest, double distance) {
+    if (orig == dest || !(distance >= 0.0) || distance == numeric_limits<double>::infinity())
+        return false;
+    resize(max(orig, dest) + 1);
+    double existing = (*this)(orig, dest);
+    if (existing != numeric_limits<double>::infinity() && existing <= distance)
+        return false;
+    size_t position = index(orig, dest);
+    if (encoding == DistanceEncoding::DOUBLE) {
+        doubles[position] = distance;
+    } else {
+        double limit = encoding == DistanceEncoding::INT32 ? INT32_MISSING - 1.0 : QUANTIZED16_MISSING - 1.0;
+        if (round(distance / scale) > limit)
+            rescale(distance);
+        if (encoding == DistanceEncoding::INT32)
+            ints[position] = (uint32_t) llround(distance / scale);
+        else
+            shorts[position] = (uint16_t) llround(distance / scale);
+    }
+    if (existing != numeric_limits<double>::infinity())
+        return false;
+    edges++;
+    return true;
+}
+
+void DistanceStore::rescale(double distance) {
+    double limit = encoding == DistanceEncoding::INT32 ? INT32_MISSING - 1.0 : QUANTIZED16_MISSING - 1.0;
+    unsigned doublings = 0;
+    while (round(distance / scale) > limit) {
+        scale *= 2.0;
+        maxError += 0.5 * scale;
+        doublings++;
+    }
+    // Arredonda ao mais próximo (empates para cima), como round, mas sem passar por double.
+    if (encoding == DistanceEncoding::INT32) {
+        for (uint32_t &value: ints)
+            if (value != INT32_MISSING)
+                value = (uint32_t) (((uint64_t) value + (1ull << (doublings - 1))) >> doublings);
+    } else {
+        for (uint16_t &value: shorts)
+            if (value != QUANTIZED16_MISSING)
+                value = (uint16_t) (((uint64_t) value + (1ull << (doublings - 1))) >> doublings);
+    }
+}
+
+size_t DistanceStore::read(const string &file, bool header, unsigned &errors) {
+    ifstream in("../files/" + file);
+    if (!in)
+        throw invalid_argument("Não foi possível abrir o ficheiro " + file + ".");
+    string line;
+    if (header)
+        getline(in, line);
+    size_t counter = 0;
+    errors = 0;
+    unsigned orig, dest;
+    double distance;
+    while (getline(in, line)) {
+        if (line.empty() || line == "\r")
+            continue;
+        if (parseEdge(line, orig, dest, distance) && set(orig, dest, distance))
+            counter++;
+        else
+            errors++;
+    }
+    doubles.shrink_to_fit();
+    ints.shrink_to_fit();
+    shorts.shrink_to_fit();
+    return counter;
+}
+
+double DistanceStore::exactCost(const string &file, bool header, const vector<unsigned> &tour) {
+    unsigned size = tour.size();
+    if (size < 2)
+        return 0.0;
+    unsigned vertices = *max_element(tour.begin(), tour.end()) + 1;
+    vector<unsigned> position(vertices, size);
+    for (unsigned i = 0; i < size; i++)
+        position[tour[i]] = i;
+    vector<double> costs(size, numeric_limits<double>::infinity());
+    ifstream in("../files/" + file);
+    if (!in)
+        throw invalid_argument("Não foi possível abrir o ficheiro " + file + ".");
+    string line;
+    if (header)
+        getline(in, line);
+    unsigned orig, dest;
+    double distance;
+    while (getline(in, line)) {
+        if (!parseEdge(line, orig, dest, distance) || orig >= vertices || dest >= vertices ||
+            position[orig] == size || position[dest] == size)
+            continue;
+        unsigned i = position[orig], j = position[dest];
+        if ((i + 1) % size == j)
+            costs[i] = min(costs[i], distance);
+        if ((j + 1) % size == i)
+            costs[j] = min(costs[j], distance);
+    }
+    double result = 0.0;
+    for (double cost: costs)
+        result += cost;
+    return result;
+}
+
+DistanceEncoding DistanceStore::getEncoding() const {
+    return encoding;
+}
+
+string DistanceStore::getEncodingName() const {
+    if (encoding == DistanceEncoding::DOUBLE)
+        return "double (64 bits)";
+    if (encoding == DistanceEncoding::INT32)
+        return "inteiro de 32 bits";
+    return "quantizada em 16 bits";
+}
+
+double DistanceStore::getScale() const {
+    return scale;
+}
+
+double DistanceStore::getMaxError() const {
+    return maxError;
+}
+
+size_t DistanceStore::getEdgeCount() const {
+    return edges;
+}
+
+bool DistanceStore::isComplete() const {
+    return edges == (size_t) n * (n - 1) / 2;
+}
+
+size_t DistanceStore::getMemoryUsage() const {
+    return sizeof(DistanceStore) + doubles.capacity() * sizeof(double) + ints.capacity() * sizeof(uint32_t) +
+           shorts.capacity() * sizeof(uint16_t);
+}
@@ -0,0 +1,183 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#ifndef TSP_DISTANCESTORE_H
+#define TSP_DISTANCESTORE_H
+
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**@brief Codificações das distâncias guardadas num DistanceStore: double (exata), inteiro de 32 bits ou inteiro de 16 bits (quantizada), ambos multiplicados por um fator de escala.
+ */
+enum class DistanceEncoding {
+    DOUBLE, INT32, QUANTIZED16
+};
+
+class DistanceStore {
+public:
+    /**@brief Construtor com parâmetros. Armazenamento compacto das distâncias de um grafo não dirigido: cada distância é guardada uma única vez, no triângulo inferior da matriz de distâncias arrumado por linhas (a linha do vértice v tem as distâncias aos vértices u < v), pelo que acrescentar vértices só acrescenta linhas no fim.
+     * Nas codificações inteiras, a distância d é guardada como round(d / scale); se uma distância não couber no intervalo da codificação, o fator de escala é duplicado (e os valores já guardados são reescalados) até caber.
+     *
+     * Complexidade Temporal: O(1)
+     * @param encoding codificação das distâncias
+     * @param scale fator de escala inicial das codificações inteiras (se 0, usa 0.001 em INT32 e 1/64 em QUANTIZED16; ignorado em DOUBLE)
+     */
+    explicit DistanceStore(DistanceEncoding encoding = DistanceEncoding::DOUBLE, double scale = 0.0);
+
+    /**@brief Retorna o número de vértices.
+     *
+     * Complexidade Temporal: O(1)
+     * @return número de vértices
+     */
+    unsigned size() const {
+        return n;
+    }
+
+    /**@brief Retorna a distância entre os vértices de id orig e dest, descodificada para double.
+     *
+     * Complexidade Temporal: O(1)
+     * @param orig id do vértice de origem
+     * @param dest id do vértice de destino
+     * @return distância entre os vértices (0 se orig e dest forem iguais, infinito se não existir aresta)
+     */
+    double operator()(unsigned orig, unsigned dest) const {
+        if (orig == dest)
+            return 0.0;
+        std::size_t position = index(orig, dest);
+        if (encoding == DistanceEncoding::DOUBLE)
+            return doubles[position];
+        if (encoding == DistanceEncoding::INT32)
+            return ints[position] == INT32_MISSING ? std::numeric_limits<double>::infinity() : ints[position] * scale;
+        return shorts[position] == QUANTIZED16_MISSING ? std::numeric_limits<double>::infinity()
+                                                       : shorts[position] * scale;
+    }
+
+    /**@brief Aumenta o número de vértices para vertices (se for maior que o atual). As distâncias dos novos vértices ficam em falta.
+     *
+     * Complexidade Temporal: O(V<SUP>2</SUP>) no pior caso, O(1) amortizado por distância acrescentada, sendo V o número de vértices
+     * @param vertices novo número de vértices
+     */
+    void resize(unsigned vertices);
+
+    /**@brief Guarda a distância distance da aresta entre os vértices de id orig e dest, acrescentando os vértices que ainda não existem. Se a aresta já existir, mantém a de menor distância.
+     *
+     * Complexidade Temporal: O(1) amortizado (O(V<SUP>2</SUP>) quando o fator de escala tem de ser aumentado, sendo V o número de vértices)
+     * @param orig id do vértice de origem
+     * @param dest id do vértice de destino
+     * @param distance distância da aresta (finita e não negativa)
+     * @return true se a aresta foi acrescentada, false se orig e dest são iguais, a distância não é válida ou a aresta já existia
+     */
+    bool set(unsigned orig, unsigned dest, double distance);
+
+    /**@brief Lê as arestas (origem, destino, distância) de um ficheiro CSV, linha a linha, sem o carregar inteiro para memória nem criar objetos Edge.
+     *
+     * Complexidade Temporal: O(n + V<SUP>2</SUP>), sendo n o tamanho do ficheiro e V o número de vértices
+     * @throws std::invalid_argument se o ficheiro não existe
+     * @param file caminho do ficheiro, relativo ao diretório files
+     * @param header true se a primeira linha do ficheiro é um cabeçalho
+     * @param errors número de linhas inválidas ou arestas duplicadas
+     * @return número de arestas lidas
+     */
+    std::size_t read(const std::string &file, bool header, unsigned &errors);
+
+    /**@brief Recalcula, em double e a partir das distâncias originais do ficheiro CSV, o custo do circuito tour, sem os erros de quantização da codificação.
+     *
+     * Complexidade Temporal: O(n + V), sendo n o tamanho do ficheiro e V o número de vértices
+     * @throws std::invalid_argument se o ficheiro não existe
+     * @param file caminho do ficheiro, relativo ao diretório files
+     * @param header true se a primeira linha do ficheiro é um cabeçalho
+     * @param tour circuito (permutação dos vértices, sem repetir o vértice inicial no fim)
+     * @return custo exato do circuito (infinito se alguma das arestas não existir no ficheiro)
+     */
+    static double exactCost(const std::string &file, bool header, const std::vector<unsigned> &tour);
+
+    /**@brief Retorna a codificação das distâncias.
+     *
+     * Complexidade Temporal: O(1)
+     * @return codificação das distâncias
+     */
+    DistanceEncoding getEncoding() const;
+
+    /**@brief Retorna o nome da codificação das distâncias.
+     *
+     * Complexidade Temporal: O(1)
+     * @return nome da codificação
+     */
+    std::string getEncodingName() const;
+
+    /**@brief Retorna o fator de escala das codificações inteiras.
+     *
+     * Complexidade Temporal: O(1)
+     * @return fator de escala (0 em DOUBLE)
+     */
+    double getScale() const;
+
+    /**@brief Retorna o erro máximo de cada distância descodificada, face à distância guardada: metade do fator de escala, mais metade de cada fator de escala anterior se os valores tiverem sido reescalados (no total, menos do que o fator de escala).
+     *
+     * Complexidade Temporal: O(1)
+     * @return erro máximo de cada distância (0 em DOUBLE)
+     */
+    double getMaxError() const;
+
+    /**@brief Retorna o número de arestas guardadas.
+     *
+     * Complexidade Temporal: O(1)
+     * @return número de arestas
+     */
+    std::size_t getEdgeCount() const;
+
+    /**@brief Indica se existem as distâncias entre todos os pares de vértices.
+     *
+     * Complexidade Temporal: O(1)
+     * @return true se o grafo é completo, false caso contrário
+     */
+    bool isComplete() const;
+
+    /**@brief Retorna a memória ocupada pelas distâncias, em bytes.
+     *
+     * Complexidade Temporal: O(1)
+     * @return memória ocupada
+     */
+    std::size_t getMemoryUsage() const;
+
+private:
+    static constexpr std::uint32_t INT32_MISSING = std::numeric_limits<std::uint32_t>::max();
+    static constexpr std::uint16_t QUANTIZED16_MISSING = std::numeric_limits<std::uint16_t>::max();
+
+    DistanceEncoding encoding;
+    double scale;
+    double maxError = 0.0;
+    unsigned n = 0;
+    std::size_t edges = 0;
+    std::vector<double> doubles;
+    std::vector<std::uint32_t> ints;
+    std::vector<std::uint16_t> shorts;
+
+    /**@brief Retorna a posição da distância entre os vértices de id orig e dest (diferentes) no triângulo inferior.
+     *
+     * Complexidade Temporal: O(1)
+     * @param orig id do vértice de origem
+     * @param dest id do vértice de destino
+     * @return posição da distância
+     */
+    static std::size_t index(unsigned orig, unsigned dest) {
+        if (orig < dest)
+            std::swap(orig, dest);
+        return (std::size_t) orig * (orig - 1) / 2 + dest;
+    }
+
+    /**@brief Duplica o fator de escala até que distance caiba no intervalo da codificação, reescalando os valores já guardados.
+     *
+     * Complexidade Temporal: O(V<SUP>2</SUP>), sendo V o número de vértices
+     * @param distance distância que tem de caber no intervalo da codificação
+     */
+    void rescale(double distance);
+};
+
+
+#endif //TSP_DISTANCESTORE_H
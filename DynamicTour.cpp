@@ -0,0 +1,283 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#include "DynamicTour.h"
+#include "DistancePolicy.h"
+#include "MetricSolver.h"
+#include <algorithm>
+#include <deque>
+#include <limits>
+#include <stdexcept>
+
+using namespace std;
+
+#define EPSILON 1e-9
+#define MAX_REVERSAL 50u
+#define CANDIDATE_LIST 32u
+
+DynamicTour::DynamicTour(const Graph &graph, const vector<unsigned> &circuit, unsigned neighbors)
+        : graph(graph), closure(graph), neighbors(max(1u, neighbors)) {
+    if (!closure.isConnected())
+        throw invalid_argument("O grafo não é conexo");
+    nearest = MetricSolver::nearestNeighbors(MatrixDistance(closure), max(CANDIDATE_LIST, this->neighbors));
+    count = closure.size() ? nearest.size() / closure.size() : 0;
+    reserve(graph.size() ? graph.size() - 1 : 0);
+    vector<unsigned> tour;
+    for (unsigned v: circuit)
+        if (graph.findVertex(v) && !member[v]) {
+            member[v] = true;
+            tour.push_back(v);
+        }
+    members = tour.size();
+    if (!members)
+        return;
+    head = tour[0];
+    for (unsigned i = 0; i < members; i++) {
+        unsigned u = tour[i], v = tour[(i + 1) % members];
+        succ[u] = v;
+        pred[v] = u;
+        cost += distance(u, v);
+    }
+}
+
+double DynamicTour::insert(unsigned id) {
+    if (!graph.findVertex(id) || contains(id))
+        throw invalid_argument("Nó inválido");
+    reserve(id);
+    if (!members) {
+        head = succ[id] = pred[id] = id;
+        member[id] = true;
+        members = 1;
+        return cost = 0.0;
+    }
+
+    unsigned bestFrom = head;
+    double bestDelta = numeric_limits<double>::infinity();
+    auto consider = [&](unsigned from) {
+        unsigned to = succ[from];
+        double delta = distance(from, id) + distance(id, to) - (from == to ? 0.0 : distance(from, to));
+        if (delta < bestDelta) {
+            bestDelta = delta;
+            bestFrom = from;
+        }
+    };
+    vector<unsigned> close = candidates(id);
+    for (unsigned c: close) {
+        consider(c);
+        consider(pred[c]);
+    }
+    if (close.empty()) {
+        unsigned v = head;
+        do {
+            consider(v);
+            v = succ[v];
+        } while (v != head);
+    }
+
+    unsigned to = succ[bestFrom];
+    succ[bestFrom] = id;
+    pred[id] = bestFrom;
+    succ[id] = to;
+    pred[to] = id;
+    member[id] = true;
+    members++;
+    cost = members == 2 ? 2 * distance(bestFrom, id) : cost + bestDelta;
+    repair({id, bestFrom, to});
+    return cost;
+}
+
+double DynamicTour::remove(unsigned id) {
+    if (!contains(id))
+        throw invalid_argument("Nó inválido");
+    member[id] = false;
+    if (--members == 0)
+        return cost = 0.0;
+    unsigned p = pred[id], s = succ[id];
+    cost += (p == s ? 0.0 : distance(p, s)) - distance(p, id) - distance(id, s);
+    if (members == 2)
+        cost = 2 * distance(p, s);
+    succ[p] = s;
+    pred[s] = p;
+    if (head == id)
+        head = s;
+    repair({p, s});
+    return cost;
+}
+
+bool DynamicTour::contains(unsigned id) const {
+    return id < member.size() && member[id];
+}
+
+unsigned DynamicTour::size() const {
+    return members;
+}
+
+double DynamicTour::getCost() const {
+    return cost;
+}
+
+vector<unsigned> DynamicTour::getCircuit() const {
+    vector<unsigned> circuit;
+    if (!members)
+        return circuit;
+    unsigned start = contains(0) ? 0 : head;
+    unsigned v = start;
+    do {
+        circuit.push_back(v);
+        v = succ[v];
+    } while (v != start);
+    circuit.push_back(start);
+    return closure.expand(circuit);
+}
+
+double DynamicTour::distance(unsigned u, unsigned v) const {
+    return closure.getDistance(u, v);
+}
+
+vector<unsigned> DynamicTour::candidates(unsigned v) const {
+    vector<unsigned> result;
+    const unsigned *list = nearest.data() + (size_t) v * count;
+    for (unsigned k = 0; k < count && result.size() < neighbors; k++)
+        if (contains(list[k]))
+            result.push_back(list[k]);
+    return result;
+}
+
+void DynamicTour::repair(vector<unsigned> dirty) {
+    if (members < 5)
+        return;
+    // Cada vértice posto na fila volta a false quando sai dela, pelo que queued fica limpo no fim.
+    deque<unsigned> queue;
+    for (unsigned v: dirty)
+        if (!queued[v]) {
+            queued[v] = true;
+            queue.push_back(v);
+        }
+    vector<unsigned> touched;
+    while (!queue.empty()) {
+        unsigned a = queue.front();
+        queue.pop_front();
+        queued[a] = false;
+        if (!member[a])
+            continue;
+        touched.clear();
+        if (twoOptMove(a, touched) || orOptMove(a, touched))
+            for (unsigned v: touched)
+                if (!queued[v]) {
+                    queued[v] = true;
+                    queue.push_back(v);
+                }
+    }
+}
+
+bool DynamicTour::twoOptMove(unsigned a, vector<unsigned> &touched) {
+    auto reaches = [this](unsigned from, unsigned to) {
+        for (unsigned steps = 0; steps <= MAX_REVERSAL; steps++, from = succ[from])
+            if (from == to)
+                return true;
+        return false;
+    };
+    for (int direction = 0; direction < 2; direction++) {
+        unsigned b = direction == 0 ? succ[a] : pred[a];
+        double ab = distance(a, b);
+        for (unsigned c: candidates(a)) {
+            double gain = ab - distance(a, c);
+            if (gain <= EPSILON)
+                break;
+            unsigned d = direction == 0 ? succ[c] : pred[c];
+            if (c == b || d == a)
+                continue;
+            gain += distance(c, d) - distance(b, d);
+            if (gain <= EPSILON)
+                continue;
+            unsigned x = direction == 0 ? a : b, x2 = direction == 0 ? b : a;
+            unsigned y = direction == 0 ? c : d, y2 = direction == 0 ? d : c;
+            if (reaches(x2, y))
+                reversePath(x2, y);
+            else if (reaches(y2, x))
+                reversePath(y2, x);
+            else
+                continue;
+            cost -= gain;
+            touched = {a, b, c, d};
+            return true;
+        }
+    }
+    return false;
+}
+
+bool DynamicTour::orOptMove(unsigned a, vector<unsigned> &touched) {
+    for (unsigned length = 1; length <= 3 && length + 3 <= members; length++) {
+        vector<unsigned> segment = {a};
+        while (segment.size() < length)
+            segment.push_back(succ[segment.back()]);
+        unsigned s = segment.front(), e = segment.back();
+        unsigned p = pred[s], q = succ[e];
+        double removal = distance(p, s) + distance(e, q) - distance(p, q);
+        if (removal <= EPSILON)
+            continue;
+        auto inside = [&segment](unsigned v) {
+            for (unsigned w: segment)
+                if (w == v)
+                    return true;
+            return false;
+        };
+        for (unsigned c: candidates(s)) {
+            if (inside(c))
+                continue;
+            for (unsigned x: {pred[c], c}) {
+                unsigned y = succ[x];
+                if (inside(x) || inside(y))
+                    continue;
+                double straight = distance(x, s) + distance(e, y) - distance(x, y);
+                double reversed = distance(x, e) + distance(s, y) - distance(x, y);
+                double insertion = min(straight, reversed);
+                if (removal - insertion <= EPSILON)
+                    continue;
+                succ[p] = q;
+                pred[q] = p;
+                if (reversed < straight)
+                    reverse(segment.begin(), segment.end());
+                unsigned previous = x;
+                for (unsigned v: segment) {
+                    succ[previous] = v;
+                    pred[v] = previous;
+                    previous = v;
+                }
+                succ[previous] = y;
+                pred[y] = previous;
+                cost -= removal - insertion;
+                touched = {p, q, x, y, s, e};
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void DynamicTour::reversePath(unsigned first, unsigned last) {
+    unsigned before = pred[first], after = succ[last];
+    unsigned v = first;
+    while (true) {
+        unsigned next = succ[v];
+        swap(succ[v], pred[v]);
+        if (v == last)
+            break;
+        v = next;
+    }
+    succ[before] = last;
+    pred[last] = before;
+    succ[first] = after;
+    pred[after] = first;
+}
+
+void DynamicTour::reserve(unsigned id) {
+    if (id < member.size())
+        return;
+    unsigned size = max(id + 1, (unsigned) member.size() * 2);
+    succ.resize(size, 0);
+    pred.resize(size, 0);
+    member.resize(size, false);
+    queued.resize(size, false);
+}
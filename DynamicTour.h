@@ -0,0 +1,145 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#ifndef TSP_DYNAMICTOUR_H
+#define TSP_DYNAMICTOUR_H
+
+
+#include <vector>
+#include "Graph.h"
+#include "MetricClosure.h"
+
+class DynamicTour {
+public:
+    /**@brief Construtor com parâmetros. Constrói um circuito dinâmico (lista duplamente ligada) sobre o fecho métrico de graph, construído uma única vez, a partir da ordem dos vértices circuit (sem expandir os caminhos entre vértices não adjacentes). Os vértices repetidos de circuit são ignorados depois da sua primeira ocorrência.
+     *
+     * Complexidade Temporal: a do fecho métrico, mais O(V<SUP>2</SUP> log(c)) para as listas de candidatos, sendo V o número de vértices do grafo e c o tamanho das listas
+     * @throws std::invalid_argument se o grafo não é conexo
+     * @param graph grafo
+     * @param circuit ordem inicial dos vértices (circuito sobre o fecho métrico, com ou sem o vértice inicial repetido no fim)
+     * @param neighbors número de vizinhos mais próximos (no circuito) considerados em cada inserção e reparação local
+     */
+    DynamicTour(const Graph &graph, const std::vector<unsigned> &circuit, unsigned neighbors = 8);
+
+    /**@brief Insere o vértice de id id no circuito, entre os vizinhos que tornam a inserção mais barata (entre os seus neighbors vizinhos mais próximos que pertencem ao circuito), e repara o circuito localmente com 2-opt e Or-opt.
+     *
+     * Complexidade Temporal: O(c + k L), sendo c o tamanho das listas de candidatos, k o número de vizinhos e L o comprimento máximo dos segmentos invertidos pelo 2-opt (no caso comum)
+     * @throws std::invalid_argument se o vértice não existe no grafo ou já pertence ao circuito
+     * @param id id do vértice a inserir
+     * @return custo do circuito depois da inserção
+     */
+    double insert(unsigned id);
+
+    /**@brief Remove o vértice de id id do circuito, ligando o seu antecessor ao seu sucessor, e repara o circuito localmente com 2-opt e Or-opt.
+     *
+     * Complexidade Temporal: O(c + k L), sendo c o tamanho das listas de candidatos, k o número de vizinhos e L o comprimento máximo dos segmentos invertidos pelo 2-opt (no caso comum)
+     * @throws std::invalid_argument se o vértice não pertence ao circuito
+     * @param id id do vértice a remover
+     * @return custo do circuito depois da remoção
+     */
+    double remove(unsigned id);
+
+    /**@brief Indica se o vértice de id id pertence ao circuito.
+     *
+     * Complexidade Temporal: O(1)
+     * @param id id do vértice
+     * @return true se o vértice pertence ao circuito, false caso contrário
+     */
+    bool contains(unsigned id) const;
+
+    /**@brief Retorna o número de vértices do circuito.
+     *
+     * Complexidade Temporal: O(1)
+     * @return número de vértices do circuito
+     */
+    unsigned size() const;
+
+    /**@brief Retorna o custo do circuito.
+     *
+     * Complexidade Temporal: O(1)
+     * @return custo do circuito
+     */
+    double getCost() const;
+
+    /**@brief Retorna o circuito, começando e acabando no vértice de id 0 (ou no primeiro vértice do circuito, se o vértice de id 0 não pertencer ao circuito), expandido para usar apenas arestas reais do grafo (pode repetir vértices).
+     *
+     * Complexidade Temporal: O(n + m), sendo n o tamanho do circuito e m o tamanho do circuito expandido
+     * @return circuito
+     */
+    std::vector<unsigned> getCircuit() const;
+
+private:
+    const Graph &graph;
+    MetricClosure closure;
+    unsigned neighbors;
+    unsigned count;
+    std::vector<unsigned> nearest;
+    std::vector<unsigned> succ;
+    std::vector<unsigned> pred;
+    std::vector<char> member;
+    std::vector<char> queued;
+    unsigned members = 0;
+    unsigned head = 0;
+    double cost = 0.0;
+
+    /**@brief Retorna a distância entre os vértices de id u e v no fecho métrico (a do caminho mais curto entre eles).
+     *
+     * Complexidade Temporal: O(1)
+     * @param u id do primeiro vértice
+     * @param v id do segundo vértice
+     * @return distância entre os dois vértices
+     */
+    double distance(unsigned u, unsigned v) const;
+
+    /**@brief Retorna os ids dos (no máximo) neighbors vizinhos mais próximos do vértice de id v que pertencem ao circuito, percorrendo a sua lista de candidatos (os vértices mais próximos no fecho métrico, por ordem crescente de distância).
+     *
+     * Complexidade Temporal: O(c), sendo c o tamanho da lista de candidatos
+     * @param v id do vértice
+     * @return vizinhos mais próximos do vértice que pertencem ao circuito
+     */
+    std::vector<unsigned> candidates(unsigned v) const;
+
+    /**@brief Repara o circuito localmente a partir dos vértices dirty: aplica movimentos 2-opt (entre cada vértice e os seus vizinhos mais próximos, invertendo segmentos curtos) e Or-opt (deslocando segmentos de 1 a 3 vértices para junto de um vizinho) enquanto o custo diminuir.
+     *
+     * Complexidade Temporal: O(m k L), sendo m o número de melhorias, k o número de vizinhos e L o comprimento máximo dos segmentos invertidos
+     * @param dirty ids dos vértices a partir dos quais procurar melhorias
+     */
+    void repair(std::vector<unsigned> dirty);
+
+    /**@brief Tenta um movimento 2-opt com origem no vértice a: substitui as arestas (a, succ(a)) e (c, succ(c)) por (a, c) e (succ(a), succ(c)), sendo c um vizinho próximo de a a uma distância (no circuito) limitada.
+     *
+     * Complexidade Temporal: O(k L), sendo k o número de vizinhos e L o comprimento máximo dos segmentos invertidos
+     * @param a id do vértice
+     * @param touched vértices cujas arestas mudaram (preenchido se o movimento foi aplicado)
+     * @return true se foi aplicado um movimento que diminui o custo, false caso contrário
+     */
+    bool twoOptMove(unsigned a, std::vector<unsigned> &touched);
+
+    /**@brief Tenta um movimento Or-opt com origem no vértice a: desloca o segmento de 1 a 3 vértices que começa em a para entre um vizinho próximo e o seu sucessor ou antecessor (numa das orientações).
+     *
+     * Complexidade Temporal: O(k), sendo k o número de vizinhos
+     * @param a id do vértice
+     * @param touched vértices cujas arestas mudaram (preenchido se o movimento foi aplicado)
+     * @return true se foi aplicado um movimento que diminui o custo, false caso contrário
+     */
+    bool orOptMove(unsigned a, std::vector<unsigned> &touched);
+
+    /**@brief Inverte o caminho do circuito de first a last (seguindo os sucessores), atualizando os sucessores e antecessores.
+     *
+     * Complexidade Temporal: O(L), sendo L o comprimento do caminho
+     * @param first id do primeiro vértice do caminho
+     * @param last id do último vértice do caminho
+     */
+    void reversePath(unsigned first, unsigned last);
+
+    /**@brief Garante que os vetores indexados por id têm espaço para o vértice de id id (o grafo pode ter crescido).
+     *
+     * Complexidade Temporal: O(V) amortizado, sendo V o número de vértices do grafo
+     * @param id id do vértice
+     */
+    void reserve(unsigned id);
+};
+
+
+#endif //TSP_DYNAMICTOUR_H
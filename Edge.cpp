@@ -21,3 +21,7 @@ Vertex *Edge::getDest() const {
 double Edge::getDistance() const {
     return this->distance;
 }
+
+void Edge::setDistance(double distance) {
+    this->distance = distance;
+}
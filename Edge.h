@@ -48,6 +48,13 @@ public:
      */
     double getDistance() const;
 
+    /**@brief Define a distância da aresta como distance. Só deve ser usado durante a construção do grafo, por quem mantém as listas de adjacências ordenadas.
+     *
+     * Complexidade Temporal: O(1)
+     * @param distance nova distância da aresta
+     */
+    void setDistance(double distance);
+
 private:
     Vertex *orig;
     Vertex *dest;
@@ -0,0 +1,82 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#include "EdgeIndex.h"
+
+using namespace std;
+
+#define EMPTY UINT64_MAX
+
+Edge *EdgeIndex::find(unsigned orig, unsigned dest) const {
+    if (keys.empty())
+        return nullptr;
+    uint64_t k = key(orig, dest);
+    size_t mask = keys.size() - 1;
+    for (size_t i = slot(k);; i = (i + 1) & mask) {
+        if (keys[i] == k)
+            return values[i];
+        if (keys[i] == EMPTY)
+            return nullptr;
+    }
+}
+
+bool EdgeIndex::insert(unsigned orig, unsigned dest, Edge *edge) {
+    if (2 * (count + 1) > keys.size())
+        grow();
+    uint64_t k = key(orig, dest);
+    size_t mask = keys.size() - 1;
+    for (size_t i = slot(k);; i = (i + 1) & mask) {
+        if (keys[i] == k)
+            return false;
+        if (keys[i] == EMPTY) {
+            keys[i] = k;
+            values[i] = edge;
+            count++;
+            return true;
+        }
+    }
+}
+
+unsigned EdgeIndex::size() const {
+    return count;
+}
+
+size_t EdgeIndex::getMemoryUsage() const {
+    return keys.capacity() * sizeof(uint64_t) + values.capacity() * sizeof(Edge *);
+}
+
+void EdgeIndex::clear() {
+    keys.clear();
+    values.clear();
+    count = 0;
+}
+
+uint64_t EdgeIndex::key(unsigned orig, unsigned dest) {
+    return ((uint64_t) orig << 32) | dest;
+}
+
+size_t EdgeIndex::slot(uint64_t key) const {
+    key += 0x9e3779b97f4a7c15ULL;
+    key = (key ^ (key >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    key = (key ^ (key >> 27)) * 0x94d049bb133111ebULL;
+    key ^= key >> 31;
+    return key & (keys.size() - 1);
+}
+
+void EdgeIndex::grow() {
+    vector<uint64_t> oldKeys = move(keys);
+    vector<Edge *> oldValues = move(values);
+    size_t capacity = oldKeys.empty() ? 16 : 2 * oldKeys.size();
+    keys.assign(capacity, EMPTY);
+    values.assign(capacity, nullptr);
+    size_t mask = capacity - 1;
+    for (size_t j = 0; j < oldKeys.size(); j++)
+        if (oldKeys[j] != EMPTY)
+            for (size_t i = slot(oldKeys[j]);; i = (i + 1) & mask)
+                if (keys[i] == EMPTY) {
+                    keys[i] = oldKeys[j];
+                    values[i] = oldValues[j];
+                    break;
+                }
+}
@@ -0,0 +1,84 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#ifndef TSP_EDGEINDEX_H
+#define TSP_EDGEINDEX_H
+
+
+#include <cstdint>
+#include <vector>
+#include "Edge.h"
+
+class EdgeIndex {
+public:
+    /**@brief Procura a aresta com origem no vértice de id orig e destino no vértice de id dest.
+     *
+     * Complexidade Temporal: O(1) (em média)
+     * @param orig id do vértice de origem
+     * @param dest id do vértice de destino
+     * @return apontador para a aresta encontrada (nullptr se não existir)
+     */
+    Edge *find(unsigned orig, unsigned dest) const;
+
+    /**@brief Insere no índice a aresta edge, com origem no vértice de id orig e destino no vértice de id dest. Se já existir uma aresta com a mesma origem e o mesmo destino, não é inserida.
+     *
+     * Complexidade Temporal: O(1) (amortizada)
+     * @param orig id do vértice de origem
+     * @param dest id do vértice de destino
+     * @param edge aresta a inserir
+     * @return true se a aresta foi inserida, false caso contrário (já existia uma aresta com a mesma origem e o mesmo destino)
+     */
+    bool insert(unsigned orig, unsigned dest, Edge *edge);
+
+    /**@brief Retorna o número de arestas no índice.
+     *
+     * Complexidade Temporal: O(1)
+     * @return número de arestas no índice
+     */
+    unsigned size() const;
+
+    /**@brief Retorna a memória ocupada pela tabela do índice.
+     *
+     * Complexidade Temporal: O(1)
+     * @return memória ocupada pela tabela, em bytes
+     */
+    std::size_t getMemoryUsage() const;
+
+    /**@brief Limpa o índice, i. e., remove todas as suas arestas.
+     *
+     * Complexidade Temporal: O(1)
+     */
+    void clear();
+
+private:
+    std::vector<std::uint64_t> keys;
+    std::vector<Edge *> values;
+    unsigned count = 0;
+
+    /**@brief Calcula a chave (orig, dest) de uma aresta, juntando os dois ids num único inteiro de 64 bits.
+     *
+     * Complexidade Temporal: O(1)
+     * @param orig id do vértice de origem
+     * @param dest id do vértice de destino
+     * @return chave da aresta
+     */
+    static std::uint64_t key(unsigned orig, unsigned dest);
+
+    /**@brief Calcula a posição inicial de uma chave na tabela (dispersão splitmix64).
+     *
+     * Complexidade Temporal: O(1)
+     * @param key chave da aresta
+     * @return posição inicial da chave na tabela
+     */
+    std::size_t slot(std::uint64_t key) const;
+
+    /**@brief Duplica a capacidade da tabela e volta a inserir todas as arestas.
+     *
+     * Complexidade Temporal: O(n), sendo n o número de arestas no índice
+     */
+    void grow();
+};
+
+
+#endif //TSP_EDGEINDEX_H
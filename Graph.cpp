@@ -4,11 +4,52 @@
 
 #include "Graph.h"
 #include "MutablePriorityQueue.h"
+#include "TourConstruction.h"
+#include "LocalSearch.h"
+#include "DistancePolicy.h"
+#include "MetricSolver.h"
+#include "SmallTsp.h"
+#include "BalasSimonetti.h"
+#include "MemoryProfiler.h"
 #include <random>
 #include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
 
 using namespace std;
 
+#define SET_NODE_SIZE (4 * sizeof(void *) + sizeof(Edge *))
+
+#define SA_SAMPLES 1000u
+#define SA_MOVES_PER_VERTEX 1000u
+#define SA_MIN_MOVES 100000u
+#define SA_INITIAL_ACCEPTANCE 0.5
+#define SA_FINAL_RATIO 1e-3
+#define SA_RANDOM_MOVES 0.1
+#define SA_STAGNATION 0.05
+#define SA_REHEAT 10.0
+
+Graph::~Graph() {
+    clear();
+}
+
+Graph::Graph(Graph &&other) noexcept {
+    *this = move(other);
+}
+
+Graph &Graph::operator=(Graph &&other) noexcept {
+    swap(vertexSet, other.vertexSet);
+    swap(edges, other.edges);
+    swap(duplicates, other.duplicates);
+    swap(index, other.index);
+    swap(originalIds, other.originalIds);
+    swap(internalIds, other.internalIds);
+    return *this;
+}
+
 Vertex *Graph::findVertex(const unsigned &id) const {
     if (id >= this->size())
         return nullptr;
@@ -22,24 +63,103 @@ bool Graph::addVertex(const unsigned &id, const double &longitude, const double
     return true;
 }
 
+void Graph::reorder(const vector<unsigned> &order) {
+    unsigned n = this->size();
+    if (edges || duplicates || order.size() != n)
+        throw invalid_argument("Renumeração inválida");
+    vector<unsigned> position(n, n);
+    for (unsigned i = 0; i < n; i++) {
+        if (order[i] >= n || position[order[i]] != n)
+            throw invalid_argument("Renumeração inválida");
+        position[order[i]] = i;
+    }
+    vector<Vertex *> reordered(n);
+    vector<unsigned> ids(n);
+    for (unsigned i = 0; i < n; i++) {
+        Vertex *v = vertexSet[order[i]];
+        reordered[i] = new Vertex(i, v->getLongitude(), v->getLatitude());
+        ids[i] = getOriginalId(order[i]);
+        delete v;
+    }
+    vertexSet = move(reordered);
+    originalIds = move(ids);
+    internalIds.assign(n, 0);
+    for (unsigned i = 0; i < n; i++)
+        internalIds[originalIds[i]] = i;
+}
+
+unsigned Graph::getOriginalId(unsigned id) const {
+    return id < originalIds.size() ? originalIds[id] : id;
+}
+
+unsigned Graph::getInternalId(unsigned originalId) const {
+    return originalId < internalIds.size() ? internalIds[originalId] : originalId;
+}
+
+const Edge *Graph::findEdge(const unsigned &orig, const unsigned &dest) const {
+    return index.find(orig, dest);
+}
+
 bool Graph::addEdge(const unsigned &orig, const unsigned &dest, const double &distance) {
     Vertex *v1 = findVertex(orig);
     Vertex *v2 = findVertex(dest);
-    if (!v1 || !v2)
+    if (!v1 || !v2 || orig == dest)
+        return false;
+    Edge *existing = index.find(orig, dest);
+    if (existing) {
+        duplicates++;
+        if (distance < existing->getDistance()) {
+            v1->setEdgeDistance(existing, distance);
+            v2->setEdgeDistance(index.find(dest, orig), distance);
+        }
         return false;
-    v1->addEdge(v2, distance);
-    v2->addEdge(v1, distance);
+    }
+    index.insert(orig, dest, v1->addEdge(v2, distance));
+    index.insert(dest, orig, v2->addEdge(v1, distance));
     edges += 1;
     return true;
 }
 
+unsigned Graph::getDuplicateEdges() const {
+    return duplicates;
+}
+
+unsigned Graph::getEdgeCount() const {
+    return edges;
+}
+
 unsigned Graph::size() const {
     return vertexSet.size();
 }
 
 void Graph::clear() {
+    for (Vertex *v: vertexSet) {
+        for (Edge *edge: v->getAdj())
+            delete edge;
+        delete v;
+    }
     vertexSet.clear();
     edges = 0;
+    duplicates = 0;
+    index.clear();
+    originalIds.clear();
+    internalIds.clear();
+}
+
+size_t Graph::getMemoryUsage() const {
+    return sizeof(Graph) + vertexSet.capacity() * sizeof(Vertex *) + vertexSet.size() * sizeof(Vertex) +
+           2 * (size_t) edges * (sizeof(Edge) + 2 * SET_NODE_SIZE) + index.getMemoryUsage() +
+           (originalIds.capacity() + internalIds.capacity()) * sizeof(unsigned);
+}
+
+size_t Graph::getVertexMemoryUsage() const {
+    return sizeof(Vertex *) + sizeof(Vertex) + 2 * sizeof(unsigned);
+}
+
+size_t Graph::getEdgeMemoryUsage() const {
+    if (!edges)
+        return 0;
+    return 2 * (sizeof(Edge) + 2 * SET_NODE_SIZE) + index.getMemoryUsage() / edges;
 }
 
 bool Graph::isComplete() const {
@@ -47,54 +167,236 @@ bool Graph::isComplete() const {
     return edges == (n * (n - 1)) / 2;
 }
 
-double Graph::tspBacktracking(vector<unsigned> &circuit) const {
+double Graph::tspBacktracking(vector<unsigned> &circuit, Incumbent *incumbent) const {
+    if (SmallTsp::supports(this->size())) {
+        double cost = SmallTsp::solve(*this, circuit);
+        if (circuit.empty())
+            return numeric_limits<unsigned>::max();
+        if (incumbent) {
+            incumbent->offer(cost, circuit, "Backtracking");
+            if (!incumbent->expired())
+                incumbent->stop();
+        }
+        return cost;
+    }
     vector<unsigned> currentPath(this->size());
     double minDist = numeric_limits<unsigned>::max();
     currentPath[0] = 0;
-    tspBacktracking(1, 0, currentPath, minDist, circuit);
+    tspBacktracking(1, 0, currentPath, minDist, circuit, incumbent);
+    if (incumbent && !incumbent->expired())
+        incumbent->stop();
     return minDist;
 }
 
-pair<double, double> Graph::tspTriangularApproximation(vector<unsigned> &circuit) const {
-    pair<double, Graph> prim = mstPrim();
+pair<double, double> Graph::tspTriangularApproximation(vector<unsigned> &circuit, bool expand) const {
+    pair<double, Graph> prim;
+    {
+        MemoryProfiler::Scope scope("MST");
+        prim = mstPrim();
+    }
+    MemoryProfiler::Scope scope("construção");
     double cost = 0.0;
-    Graph mst = prim.second;
+    const Graph &mst = prim.second;
+    SolverState state(mst.size());
     for (unsigned i = 0; i < mst.size(); i++) {
-        Vertex *vertex = mst.findVertex(i);
-        if (!vertex->isVisited())
-            vertex->dfsPreorder(circuit);
+        const Vertex *vertex = mst.findVertex(i);
+        if (!state.isVisited(i))
+            vertex->dfsPreorder(circuit, state);
     }
     circuit.push_back(0);
-    for (unsigned i = 0; i < circuit.size() - 1; i++) {
-        const Vertex *source = findVertex(circuit[i]);
-        const Vertex *dest = findVertex(circuit[i + 1]);
-        const Edge *edge = source->getEdge(dest);
-        cost += edge ? edge->getDistance() : source->calculateDistance(dest);
+    if (isComplete()) {
+        for (unsigned i = 0; i < circuit.size() - 1; i++)
+            cost += findEdge(circuit[i], circuit[i + 1])->getDistance();
+        return make_pair(prim.first, cost);
     }
+    MetricClosure closure(*this);
+    if (!closure.isConnected())
+        throw invalid_argument("O grafo não é conexo");
+    cost = closure.cost(circuit);
+    if (expand)
+        circuit = closure.expand(circuit);
     return make_pair(prim.first, cost);
 }
 
-pair<double, double> Graph::tspHeuristic(vector<unsigned> &circuit) const {
-    double before = tspNearestNeighbor(circuit);
-    double after = tspSimulatedAnnealing(before, circuit);
+pair<double, double> Graph::tspHeuristic(vector<unsigned> &circuit, Incumbent *incumbent,
+                                         const vector<unsigned> *warmStart, unsigned long moves,
+                                         double seconds, unsigned seed) const {
+    MemoryProfiler::Scope scope("fecho métrico");
+    MetricClosure closure(*this);
+    scope.stop();
+    return tspHeuristic(closure, circuit, incumbent, warmStart, moves, seconds, seed);
+}
+
+pair<double, double> Graph::tspHeuristic(const MetricClosure &closure, vector<unsigned> &circuit,
+                                         Incumbent *incumbent, const vector<unsigned> *warmStart,
+                                         unsigned long moves, double seconds, unsigned seed) const {
+    if (!closure.isConnected())
+        throw invalid_argument("O grafo não é conexo");
+    MemoryProfiler::Scope construction("construção");
+    double before = tspInitialCircuit(closure, circuit, warmStart);
+    construction.stop();
+    MemoryProfiler::Scope optimization("otimização");
+    if (incumbent)
+        incumbent->offer(before, closure.expand(circuit), warmStart ? "Circuito inicial" : "Nearest Neighbor");
+    double after = tspSimulatedAnnealing(closure, before, circuit, incumbent, moves, seconds, seed);
+    circuit = closure.expand(circuit);
+    if (incumbent)
+        incumbent->offer(after, circuit, "Nearest Neighbor e Simulated Annealing (2-opt)");
     return make_pair(before, after);
 }
 
+pair<double, double> Graph::tspBestImprovement(vector<unsigned> &circuit, Incumbent *incumbent,
+                                               const vector<unsigned> *warmStart, unsigned threads) const {
+    MemoryProfiler::Scope scope("fecho métrico");
+    MetricClosure closure(*this, threads);
+    scope.stop();
+    if (!closure.isConnected())
+        throw invalid_argument("O grafo não é conexo");
+    MemoryProfiler::Scope construction("construção");
+    double before = tspInitialCircuit(closure, circuit, warmStart);
+    construction.stop();
+    MemoryProfiler::Scope optimization("otimização");
+    double after = LocalSearch::bestImprovement(closure, circuit, threads);
+    circuit = closure.expand(circuit);
+    if (incumbent)
+        incumbent->offer(after, circuit, "Nearest Neighbor e 2-opt de melhor melhoria");
+    return make_pair(before, after);
+}
+
+double Graph::tspBalasSimonetti(vector<unsigned> &circuit, unsigned window) const {
+    MemoryProfiler::Scope scope("fecho métrico");
+    MetricClosure closure(*this);
+    scope.stop();
+    if (!closure.isConnected())
+        throw invalid_argument("O grafo não é conexo");
+    MemoryProfiler::Scope optimization("pós-otimização");
+    double cost = BalasSimonetti(closure, window).optimize(circuit);
+    circuit = closure.expand(circuit);
+    return cost;
+}
+
+vector<unsigned> Graph::tspChristofides(const MetricClosure &closure) const {
+    if (!closure.isConnected())
+        throw invalid_argument("O grafo não é conexo");
+    unsigned n = this->size();
+    if (n < 3) {
+        vector<unsigned> tour(n);
+        for (unsigned i = 0; i < n; i++)
+            tour[i] = i;
+        return tour;
+    }
+
+    vector<vector<pair<unsigned, unsigned>>> multigraph(n);
+    unsigned links = 0;
+    auto link = [&multigraph, &links](unsigned u, unsigned v) {
+        multigraph[u].emplace_back(v, links);
+        multigraph[v].emplace_back(u, links);
+        links++;
+    };
+    MemoryProfiler::Scope scope("MST");
+    Graph mst = mstPrim().second;
+    scope.stop();
+    for (unsigned v = 0; v < n; v++)
+        for (const auto &edge: mst.findVertex(v)->getAdj())
+            if (v < edge->getDest()->getId())
+                link(v, edge->getDest()->getId());
+    vector<unsigned> odd;
+    for (unsigned v = 0; v < n; v++)
+        if (multigraph[v].size() % 2)
+            odd.push_back(v);
+    for (const auto &pair: perfectMatching(closure, odd))
+        link(pair.first, pair.second);
+
+    vector<char> used(links, false);
+    vector<unsigned> next(n, 0);
+    vector<unsigned> stack = {0};
+    vector<char> visited(n, false);
+    vector<unsigned> euler;
+    while (!stack.empty()) {
+        unsigned v = stack.back();
+        while (next[v] < multigraph[v].size() && used[multigraph[v][next[v]].second])
+            next[v]++;
+        if (next[v] == multigraph[v].size()) {
+            euler.push_back(v);
+            stack.pop_back();
+        } else {
+            used[multigraph[v][next[v]].second] = true;
+            stack.push_back(multigraph[v][next[v]].first);
+        }
+    }
+    vector<unsigned> tour;
+    tour.reserve(n);
+    for (unsigned v: euler)
+        if (!visited[v]) {
+            visited[v] = true;
+            tour.push_back(v);
+        }
+    return tour;
+}
+
+vector<pair<unsigned, unsigned>> Graph::perfectMatching(const MetricClosure &closure, const vector<unsigned> &odd) {
+    unsigned m = odd.size();
+    vector<pair<unsigned, unsigned>> candidates;
+    candidates.reserve((size_t) m * (m - 1) / 2);
+    for (unsigned i = 0; i < m; i++)
+        for (unsigned j = i + 1; j < m; j++)
+            candidates.emplace_back(odd[i], odd[j]);
+    sort(candidates.begin(), candidates.end(), [&closure](const pair<unsigned, unsigned> &a, const pair<unsigned, unsigned> &b) {
+        return closure.getDistance(a.first, a.second) < closure.getDistance(b.first, b.second);
+    });
+    vector<char> matched(closure.size(), false);
+    vector<pair<unsigned, unsigned>> matching;
+    matching.reserve(m / 2);
+    for (const auto &candidate: candidates)
+        if (!matched[candidate.first] && !matched[candidate.second]) {
+            matched[candidate.first] = matched[candidate.second] = true;
+            matching.push_back(candidate);
+        }
+
+    bool improved = true;
+    while (improved) {
+        improved = false;
+        for (unsigned i = 0; i < matching.size(); i++)
+            for (unsigned j = i + 1; j < matching.size(); j++) {
+                unsigned a = matching[i].first, b = matching[i].second;
+                unsigned c = matching[j].first, d = matching[j].second;
+                double current = closure.getDistance(a, b) + closure.getDistance(c, d);
+                double crossed = closure.getDistance(a, c) + closure.getDistance(b, d);
+                double swapped = closure.getDistance(a, d) + closure.getDistance(b, c);
+                if (crossed < swapped && crossed < current - 1e-9) {
+                    matching[i] = make_pair(a, c);
+                    matching[j] = make_pair(b, d);
+                    improved = true;
+                } else if (swapped < current - 1e-9) {
+                    matching[i] = make_pair(a, d);
+                    matching[j] = make_pair(b, c);
+                    improved = true;
+                }
+            }
+    }
+    return matching;
+}
+
 void Graph::tspBacktracking(unsigned currentIndex, double currentCost, vector<unsigned> &currentPath, double &minCost,
-                            vector<unsigned> &circuit) const {
+                            vector<unsigned> &circuit, Incumbent *incumbent) const {
+    if (incumbent && incumbent->expired())
+        return;
     unsigned size = this->size();
     const Edge *edge;
-    if (currentIndex == size && (edge = findVertex(currentPath[size - 1])->getEdge(findVertex(currentPath[0])))) {
+    if (currentIndex == size && (edge = findEdge(currentPath[size - 1], currentPath[0]))) {
         currentCost += edge->getDistance();
         if (currentCost < minCost) {
             minCost = currentCost;
             circuit = currentPath;
             circuit.push_back(0);
+            if (incumbent)
+                incumbent->offer(minCost, circuit, "Backtracking");
         }
     }
+    double bound = incumbent ? min(minCost, incumbent->getBound()) : minCost;
     for (unsigned i = 1; i < size; i++) {
-        edge = findVertex(currentPath[currentIndex - 1])->getEdge(findVertex(i));
-        if (edge && currentCost + edge->getDistance() < minCost) {
+        edge = findEdge(currentPath[currentIndex - 1], i);
+        if (edge && currentCost + edge->getDistance() < bound) {
             bool unvisited = true;
             for (unsigned j = 1; j < currentIndex; j++)
                 if (currentPath[j] == i) {
@@ -103,7 +405,9 @@ void Graph::tspBacktracking(unsigned currentIndex, double currentCost, vector<un
                 }
             if (unvisited) {
                 currentPath[currentIndex] = i;
-                tspBacktracking(currentIndex + 1, currentCost + edge->getDistance(), currentPath, minCost, circuit);
+                tspBacktracking(currentIndex + 1, currentCost + edge->getDistance(), currentPath, minCost, circuit,
+                                incumbent);
+                bound = incumbent ? min(minCost, incumbent->getBound()) : minCost;
             }
         }
     }
@@ -112,132 +416,168 @@ void Graph::tspBacktracking(unsigned currentIndex, double currentCost, vector<un
 pair<double, Graph> Graph::mstPrim() const {
     double cost = 0.0;
     Graph mst;
+    SolverState state(this->size());
+    state.reset((double) INT_MAX);
 
-    for (const auto v: vertexSet) {
-        v->setVisited(false);
-        v->setDistance((double) INT_MAX);
-        v->setPath(nullptr);
+    for (const auto v: vertexSet)
         mst.addVertex(v->getId(), v->getLongitude(), v->getLatitude());
-    }
 
-    MutablePriorityQueue<Vertex> q;
-    Vertex *root = findVertex(0);
-    root->setDistance(0.0);
-    q.insert(root);
-    while (!q.empty()) {
-        auto v = q.extractMin();
-        v->setVisited(true);
-        for (const auto &edge: v->getAdj()) {
-            Vertex *u = edge->getDest();
-            if (!u->isVisited()) {
-                double distance = u->getDistance();
+    state.setDistance(0, 0.0);
+    state.insert(0);
+    while (!state.empty()) {
+        unsigned v = state.extractMin();
+        state.setVisited(v, true);
+        for (const auto &edge: findVertex(v)->getAdj()) {
+            unsigned u = edge->getDest()->getId();
+            if (!state.isVisited(u)) {
+                double distance = state.getDistance(u);
                 if (edge->getDistance() < distance) {
-                    u->setDistance(edge->getDistance());
-                    u->setPath(edge);
+                    state.setDistance(u, edge->getDistance());
+                    state.setPath(u, edge);
                     if (distance == (double) INT_MAX)
-                        q.insert(u);
+                        state.insert(u);
                     else
-                        q.decreaseKey(u);
+                        state.decreaseKey(u);
                 }
             }
         }
     }
 
     for (const auto v: vertexSet) {
-        v->setVisited(false);
-        Edge *edge = v->getPath();
+        const Edge *edge = state.getPath(v->getId());
         if (edge) {
             mst.addEdge(v->getId(), edge->getOrig()->getId(), edge->getDistance());
             cost += edge->getDistance();
         }
     }
 
-    return make_pair(cost, mst);
+    return make_pair(cost, move(mst));
 }
 
-double Graph::tspNearestNeighbor(vector<unsigned> &circuit) const {
-    double cost = 0.0;
+double Graph::tspInitialCircuit(const MetricClosure &closure, vector<unsigned> &circuit,
+                                const vector<unsigned> *warmStart) const {
+    if (!warmStart)
+        return tspNearestNeighbor(closure, circuit);
+    vector<char> seen(closure.size(), false);
+    vector<unsigned> tour;
+    for (unsigned v: *warmStart) {
+        if (v >= closure.size())
+            throw invalid_argument("O circuito inicial não corresponde ao grafo");
+        if (!seen[v]) {
+            seen[v] = true;
+            tour.push_back(v);
+        }
+    }
+    if (tour.size() != closure.size())
+        throw invalid_argument("O circuito inicial não corresponde ao grafo");
+    circuit = TourConstruction::toCircuit(tour);
+    return closure.cost(circuit);
+}
 
-    for (const auto v: vertexSet) {
-        v->setVisited(false);
-        v->setDistance((double) INT_MAX);
-        v->setPath(nullptr);
-    }
-
-    Vertex *vertex = findVertex(0);
-    vertex->setVisited(true);
-    circuit.push_back(vertex->getId());
-    for (unsigned i = 0; i < size() - 1; i++) {
-        Edge *edge = vertex->getNearestNeighbor();
-        vertex = edge->getDest();
-        vertex->setVisited(true);
-        vertex->setDistance(edge->getDistance());
-        vertex->setPath(edge);
-        circuit.push_back(vertex->getId());
-        cost += edge->getDistance();
-    }
-    cost += findVertex(circuit.back())->getEdge(findVertex(0))->getDistance();
-    circuit.push_back(0);
+double Graph::tspNearestNeighbor(const MetricClosure &closure, vector<unsigned> &circuit) const {
+    vector<unsigned> tour;
+    double cost = MetricSolver::nearestNeighbor(MatrixDistance(closure), tour);
+    circuit = TourConstruction::toCircuit(tour);
     return cost;
 }
 
-std::pair<double, std::vector<unsigned>> Graph::tspTwoOptSwap(double cost, const vector<unsigned> &circuit) const {
-    random_device device;
-    mt19937 rng(device());
-    uniform_int_distribution<unsigned> distribution(0, circuit.size() - 2);
-    unsigned first = distribution(rng);
-    unsigned second = distribution(rng);
-
-    if (second == first)
-        return make_pair(cost, circuit);
-
-    if (first > second) {
-        unsigned temp = first;
-        first = second;
-        second = temp;
+double Graph::tspTwoOptMove(const MetricClosure &closure, const vector<unsigned> &tour, const vector<unsigned> &pos,
+                           unsigned a, unsigned b, bool successor, unsigned &i, unsigned &j) {
+    unsigned n = tour.size();
+    unsigned pa = pos[a], pb = pos[b];
+    unsigned na = successor ? (pa + 1 == n ? 0 : pa + 1) : (pa == 0 ? n - 1 : pa - 1);
+    unsigned nb = successor ? (pb + 1 == n ? 0 : pb + 1) : (pb == 0 ? n - 1 : pb - 1);
+    if (a == b || tour[na] == b || tour[nb] == a) {
+        i = j = pa;
+        return 0.0;
     }
+    if (successor) {
+        i = na;
+        j = pb;
+    } else {
+        i = pa;
+        j = nb;
+    }
+    return closure.getDistance(a, b) + closure.getDistance(tour[na], tour[nb]) - closure.getDistance(a, tour[na]) -
+           closure.getDistance(b, tour[nb]);
+}
 
-    Edge *oldFirst = findVertex(circuit[first])->getEdge(findVertex(circuit[first + 1]));
-    Edge *oldSecond = findVertex(circuit[second])->getEdge(findVertex(circuit[second + 1]));
-
-    Edge *newFirst = findVertex(circuit[first])->getEdge(findVertex(circuit[second]));
-    Edge *newSecond = findVertex(circuit[first + 1])->getEdge(findVertex(circuit[second + 1]));
-
-    double delta =
-            oldFirst->getDistance() + oldSecond->getDistance() - newFirst->getDistance() - newSecond->getDistance();
+double Graph::tspSimulatedAnnealing(const MetricClosure &closure, double cost, vector<unsigned> &circuit,
+                                    Incumbent *incumbent, unsigned long moves, double seconds,
+                                    unsigned seed) const {
+    unsigned n = closure.size();
+    if (n < 4)
+        return cost;
+    mt19937 rng(seed);
+    uniform_real_distribution<double> distribution(0.0, 1.0);
+    uniform_int_distribution<unsigned> vertices(0, n - 1);
+    LocalSearch local(closure);
+    uniform_int_distribution<unsigned> candidates(0, local.getNeighborCount() - 1);
 
-    vector<unsigned> tentative = circuit;
-    reverse(tentative.begin() + first + 1, tentative.begin() + second + 1);
+    vector<unsigned> tour(circuit.begin(), circuit.end() - 1);
+    vector<unsigned> pos(n);
+    for (unsigned p = 0; p < n; p++)
+        pos[tour[p]] = p;
+    auto propose = [&](unsigned &i, unsigned &j) {
+        unsigned a = vertices(rng);
+        unsigned b = distribution(rng) < SA_RANDOM_MOVES ? vertices(rng) : local.getNeighbors(a)[candidates(rng)];
+        return tspTwoOptMove(closure, tour, pos, a, b, distribution(rng) < 0.5, i, j);
+    };
 
-    return make_pair(cost - delta, tentative);
-}
+    double uphill = 0.0;
+    unsigned count = 0;
+    for (unsigned s = 0; s < SA_SAMPLES; s++) {
+        unsigned i, j;
+        double delta = propose(i, j);
+        if (delta > 0) {
+            uphill += delta;
+            count++;
+        }
+    }
+    if (count == 0)
+        return cost;
+    double initial = -(uphill / count) / log(SA_INITIAL_ACCEPTANCE);
 
-double Graph::tspSimulatedAnnealing(double cost, vector<unsigned> &circuit) const {
-    random_device device;
-    mt19937 rng(device());
-    uniform_real_distribution<double> distribution(0.0, 1.0);
+    if (moves == 0)
+        moves = seconds > 0.0 ? ULONG_MAX : max((unsigned long) SA_MOVES_PER_VERTEX * n, (unsigned long) SA_MIN_MOVES);
+    auto start = chrono::steady_clock::now();
+    double lastImprovement = 0.0, reheated = -1.0;
 
     double bestCost = cost;
-    vector<unsigned> bestCircuit = circuit;
-    for (double temperature = 100.0; temperature > 0.1; temperature *= 0.9)
-        for (unsigned i = 0; i < circuit.size(); i++) {
-            pair<double, vector<unsigned>> neighbor = tspTwoOptSwap(cost, circuit);
-            double delta = neighbor.first - cost;
-            if (delta <= 0) {
-                cost = neighbor.first;
-                circuit = neighbor.second;
-                if (cost < bestCost) {
+    vector<unsigned> bestTour = tour;
+    for (unsigned long done = 0; done < moves; done += n) {
+        if (incumbent && (incumbent->expired() || incumbent->reached(bestCost)))
+            break;
+        double progress = (double) done / moves;
+        if (seconds > 0.0) {
+            double elapsed = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+            progress = max(progress, elapsed / seconds);
+            if (progress >= 1.0)
+                break;
+        }
+        if (progress - lastImprovement >= SA_STAGNATION && progress < 1.0 - SA_STAGNATION) {
+            tour = bestTour;
+            for (unsigned p = 0; p < n; p++)
+                pos[tour[p]] = p;
+            cost = bestCost;
+            lastImprovement = reheated = progress;
+        }
+        double heat = reheated < 0.0 ? 1.0 : pow(SA_REHEAT, max(0.0, 1.0 - (progress - reheated) / SA_STAGNATION));
+        double temperature = initial * pow(SA_FINAL_RATIO, progress) * heat;
+        for (unsigned m = 0; m < n; m++) {
+            unsigned i, j;
+            double delta = propose(i, j);
+            if (delta <= 0 ? i != j : distribution(rng) < exp(-delta / temperature)) {
+                LocalSearch::reverse(tour, pos, i, j);
+                cost += delta;
+                if (cost < bestCost - 1e-9) {
                     bestCost = cost;
-                    bestCircuit = circuit;
-                }
-            } else {
-                double random = distribution(rng);
-                if (random < exp(-delta / temperature)) {
-                    cost = neighbor.first;
-                    circuit = neighbor.second;
+                    bestTour = tour;
+                    lastImprovement = progress;
                 }
             }
         }
-    circuit = bestCircuit;
-    return bestCost;
+    }
+    circuit = TourConstruction::toCircuit(bestTour);
+    return closure.cost(circuit);
 }
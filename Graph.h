@@ -6,11 +6,46 @@
 #define TSP_GRAPH_H
 
 
+#include <random>
 #include <vector>
 #include "Vertex.h"
+#include "EdgeIndex.h"
+#include "Incumbent.h"
+#include "MetricClosure.h"
 
 class Graph {
 public:
+    /**@brief Construtor sem parâmetros. Constrói um grafo vazio.
+     *
+     * Complexidade Temporal: O(1)
+     */
+    Graph() = default;
+
+    /**@brief Destrutor. Liberta os vértices e as arestas do grafo, que pertencem ao grafo.
+     *
+     * Complexidade Temporal: O(V + E), sendo V o número de vértices e E o número de arestas do grafo
+     */
+    ~Graph();
+
+    Graph(const Graph &) = delete;
+
+    Graph &operator=(const Graph &) = delete;
+
+    /**@brief Construtor de movimento. Transfere os vértices e as arestas de other para o grafo construído, deixando other vazio.
+     *
+     * Complexidade Temporal: O(1)
+     * @param other grafo a mover
+     */
+    Graph(Graph &&other) noexcept;
+
+    /**@brief Atribuição por movimento. Troca os vértices e as arestas do grafo com os de other, que liberta os anteriores quando for destruído.
+     *
+     * Complexidade Temporal: O(1)
+     * @param other grafo a mover
+     * @return referência para o grafo
+     */
+    Graph &operator=(Graph &&other) noexcept;
+
     /**@brief Procura o vértice do grafo pelo seu id.
      *
      * Complexidade Temporal: O(1)
@@ -29,16 +64,65 @@ public:
      */
     bool addVertex(const unsigned &id, const double &longitude = 0.0, const double &latitude = 0.0);
 
+    /**@brief Renumera os vértices do grafo segundo order: o vértice de id order[i] passa a ter id i. Os ids originais são guardados para apresentar os resultados.
+     * Deve ser usada antes de adicionar arestas, para que os vértices próximos (por exemplo, ao longo de uma curva de Hilbert) fiquem contíguos em memória.
+     *
+     * Complexidade Temporal: O(V), sendo V o número de vértices do grafo
+     * @throws std::invalid_argument se o grafo já tem arestas ou order não é uma permutação dos ids dos vértices
+     * @param order nova ordem dos vértices (ids atuais)
+     */
+    void reorder(const std::vector<unsigned> &order);
+
+    /**@brief Retorna o id original (lido do ficheiro) do vértice de id id.
+     *
+     * Complexidade Temporal: O(1)
+     * @param id id do vértice no grafo
+     * @return id original do vértice (id, se o grafo não foi renumerado)
+     */
+    unsigned getOriginalId(unsigned id) const;
+
+    /**@brief Retorna o id no grafo do vértice de id original (lido do ficheiro) originalId.
+     *
+     * Complexidade Temporal: O(1)
+     * @param originalId id original do vértice
+     * @return id do vértice no grafo (originalId, se o grafo não foi renumerado ou o vértice não existe)
+     */
+    unsigned getInternalId(unsigned originalId) const;
+
+    /**@brief Procura a aresta com origem no vértice de id orig e destino no vértice de id dest.
+     *
+     * Complexidade Temporal: O(1) (em média)
+     * @param orig id do vértice de origem
+     * @param dest id do vértice de destino
+     * @return apontador para a aresta encontrada (nullptr se não existir)
+     */
+    const Edge *findEdge(const unsigned &orig, const unsigned &dest) const;
+
     /**@brief Adiciona ao grafo uma aresta bidirecional com origem no vértice de id orig e destino no vértice de id dest, com distância distance.
+     * Se já existir uma aresta entre os dois vértices, a aresta não é adicionada novamente: mantém-se a de menor distância, independentemente da ordem de leitura.
      *
      * Complexidade Temporal: O(log n), sendo n o tamanho da lista de adjacências do vértice de origem/destino
      * @param orig id do vértice de origem da aresta a adicionar
      * @param dest id do vértice de destino da aresta a adicionar
      * @param distance distância da aresta a adicionar
-     * @return true se a operação foi bem-sucedida, false caso contrário (não existe no grafo nenhum vértice com id orig ou com id dest)
+     * @return true se a operação foi bem-sucedida, false caso contrário (não existe no grafo nenhum vértice com id orig ou com id dest, orig e dest são o mesmo vértice ou a aresta é duplicada)
      */
     bool addEdge(const unsigned &orig, const unsigned &dest, const double &distance);
 
+    /**@brief Retorna o número de arestas duplicadas encontradas ao adicionar arestas ao grafo.
+     *
+     * Complexidade Temporal: O(1)
+     * @return número de arestas duplicadas
+     */
+    unsigned getDuplicateEdges() const;
+
+    /**@brief Retorna o número de arestas (sem contar duplicadas) do grafo.
+     *
+     * Complexidade Temporal: O(1)
+     * @return número de arestas do grafo
+     */
+    unsigned getEdgeCount() const;
+
     /**@brief Retorna o tamanho (número de nós) do grafo.
      *
      * Complexidade Temporal: O(1)
@@ -46,13 +130,34 @@ public:
      */
     unsigned size() const;
 
-    /**@brief Limpa o grafo, i. e., remove todos os seus vértices.
+    /**@brief Limpa o grafo, i. e., remove e liberta todos os seus vértices e arestas.
      *
-     * Complexidade Temporal: O(1)
+     * Complexidade Temporal: O(V + E), sendo V o número de vértices e E o número de arestas do grafo
      */
     void clear();
 
-    /**@brief Indica se o grafo é completo.
+    /**@brief Estima a memória ocupada pelo grafo: vértices, arestas (cada aresta é guardada nos dois sentidos, nas listas de adjacências de saída e de entrada), índice de arestas e tabelas de ids.
+     *
+     * Complexidade Temporal: O(1)
+     * @return memória ocupada pelo grafo, em bytes (estimativa)
+     */
+    std::size_t getMemoryUsage() const;
+
+    /**@brief Estima a memória ocupada por cada vértice na representação atual: o objeto Vertex, o apontador em vertexSet e as entradas nas tabelas de ids.
+     *
+     * Complexidade Temporal: O(1)
+     * @return memória ocupada por vértice, em bytes (estimativa)
+     */
+    std::size_t getVertexMemoryUsage() const;
+
+    /**@brief Estima a memória ocupada por cada aresta na representação atual: dois objetos Edge (um por sentido), quatro nós de multiset (listas de adjacências de saída e de entrada) e a parte do índice de arestas.
+     *
+     * Complexidade Temporal: O(1)
+     * @return memória ocupada por aresta, em bytes (estimativa; 0 se o grafo não tem arestas)
+     */
+    std::size_t getEdgeMemoryUsage() const;
+
+    /**@brief Indica se o grafo é completo, i. e., se existe uma aresta (sem contar duplicadas) entre cada par de vértices distintos.
      *
      * Complexidade Temporal: O(1)
      * @return true se o grafo é completo, false caso contrário
@@ -60,32 +165,107 @@ public:
     bool isComplete() const;
 
     /**@brief Resolve o Travelling Salesperson Problem (TSP) através de um algoritmo de backtracking.
+     * Grafos com até SMALL_TSP_MAX vértices são resolvidos por SmallTsp, especializado em tempo de compilação para o número de vértices.
      *
      * Complexidade Temporal: O(V!), sendo V o número de vértices
      * @param circuit circuito encontrado como solução para o Travelling Salesperson Problem (TSP)
+     * @param incumbent melhor solução conhecida partilhada com outras execuções, usada como limite superior para a poda e para o prazo limite (opcional)
      * @return custo do circuito encontrado como solução para o Travelling Salesperson Problem (TSP)
      */
-    double tspBacktracking(std::vector<unsigned> &circuit) const;
+    double tspBacktracking(std::vector<unsigned> &circuit, Incumbent *incumbent = nullptr) const;
 
     /**@brief Resolve (de forma aproximada) o Travelling Salesperson Problem (TSP) através de uma heurística de aproximação triangular.
+     * Se o grafo não for completo, os custos entre vértices não adjacentes são os do fecho métrico e o circuito é expandido para usar apenas arestas reais (exceto se expand for false).
      *
-     * Complexidade Temporal: O(V<SUP>2</SUP>), sendo V o número de vértices do grafo
+     * Complexidade Temporal: O(V<SUP>2</SUP>) se o grafo for completo, a do fecho métrico caso contrário, sendo V o número de vértices do grafo
+     * @throws std::invalid_argument se o grafo não é conexo
      * @param circuit circuito encontrado como solução aproximada para o Travelling Salesperson Problem (TSP)
+     * @param expand false para retornar a ordem dos vértices sobre o fecho métrico, sem expandir os caminhos entre vértices não adjacentes (opcional)
      * @return par cujo primeiro valor é o custo da Minimum Cost Spanning Tree (MST) determinada para a heurística e o segundo valor é o custo do circuito encontrado como solução aproximada para o Travelling Salesperson Problem (TSP)
      */
-    std::pair<double, double> tspTriangularApproximation(std::vector<unsigned> &circuit) const;
+    std::pair<double, double> tspTriangularApproximation(std::vector<unsigned> &circuit, bool expand = true) const;
 
     /**@brief Resolve (de forma aproximada) o Travelling Salesperson Problem (TSP) através da combinação de várias heurísticas: Nearest Neighbor para a construção do caminho e Simulated Annealing com 2-opt para a otimização.
      *
-     * Complexidade Temporal: O(V<SUP>2</SUP>), sendo V o número de vértices do grafo
+     * Se o grafo não for completo, a heurística corre sobre o fecho métrico do grafo e o circuito é expandido para usar apenas arestas reais.
+     *
+     * Complexidade Temporal: O(V<SUP>2</SUP>) se o grafo for completo, a do fecho métrico caso contrário, sendo V o número de vértices do grafo
+     * @throws std::invalid_argument se o grafo não é conexo
      * @param circuit circuito encontrado como solução aproximada para o Travelling Salesperson Problem (TSP)
+     * @param incumbent melhor solução conhecida partilhada com outras execuções, à qual é proposto o circuito encontrado e que define o prazo limite (opcional)
+     * @param warmStart circuito a usar como ponto de partida em vez do Nearest Neighbor, por exemplo o melhor circuito conhecido guardado em cache (opcional)
+     * @param moves número de trocas do Simulated Annealing (0 para um orçamento proporcional ao número de vértices)
+     * @param seconds tempo do Simulated Annealing, em segundos (0 para usar apenas o número de trocas)
+     * @param seed semente do gerador de números aleatórios do Simulated Annealing
      * @return par cujo primeiro valor é o custo do circuito encontrado como solução aproximada para o Travelling Salesperson Problem (TSP) antes da otimização e o segundo valor é o custo do circuito encontrado como solução aproximada para o Travelling Salesperson Problem (TSP) depois da otimização
      */
-    std::pair<double, double> tspHeuristic(std::vector<unsigned> &circuit) const;
+    std::pair<double, double> tspHeuristic(std::vector<unsigned> &circuit, Incumbent *incumbent = nullptr,
+                                           const std::vector<unsigned> *warmStart = nullptr, unsigned long moves = 0,
+                                           double seconds = 0.0, unsigned seed = std::random_device()()) const;
+
+    /**@brief Resolve (de forma aproximada) o Travelling Salesperson Problem (TSP) através da combinação de várias heurísticas, sobre o fecho métrico closure do grafo já construído (permite partilhar o fecho métrico entre várias execuções).
+     *
+     * Complexidade Temporal: O(V<SUP>2</SUP>), sendo V o número de vértices do grafo
+     * @throws std::invalid_argument se o grafo não é conexo
+     * @param closure fecho métrico do grafo
+     * @param circuit circuito encontrado como solução aproximada para o Travelling Salesperson Problem (TSP), expandido para usar apenas arestas reais
+     * @param incumbent melhor solução conhecida partilhada com outras execuções, à qual é proposto o circuito encontrado e que define o prazo limite (opcional)
+     * @param warmStart circuito a usar como ponto de partida em vez do Nearest Neighbor (pode repetir vértices, como os circuitos expandidos; só conta a primeira ocorrência de cada vértice) (opcional)
+     * @param moves número de trocas do Simulated Annealing (0 para um orçamento proporcional ao número de vértices)
+     * @param seconds tempo do Simulated Annealing, em segundos (0 para usar apenas o número de trocas)
+     * @param seed semente do gerador de números aleatórios do Simulated Annealing
+     * @return par cujo primeiro valor é o custo do circuito antes da otimização e o segundo valor é o custo do circuito depois da otimização
+     */
+    std::pair<double, double> tspHeuristic(const MetricClosure &closure, std::vector<unsigned> &circuit,
+                                           Incumbent *incumbent = nullptr,
+                                           const std::vector<unsigned> *warmStart = nullptr, unsigned long moves = 0,
+                                           double seconds = 0.0, unsigned seed = std::random_device()()) const;
+
+    /**@brief Resolve (de forma aproximada) o Travelling Salesperson Problem (TSP) através da heurística Nearest Neighbor para a construção do caminho e de 2-opt de melhor melhoria (determinístico, com SIMD e várias threads) para a otimização.
+     *
+     * Se o grafo não for completo, a heurística corre sobre o fecho métrico do grafo e o circuito é expandido para usar apenas arestas reais.
+     *
+     * Complexidade Temporal: O(p V<SUP>2</SUP> / (W t)) se o grafo for completo, mais a do fecho métrico caso contrário, sendo V o número de vértices do grafo, p o número de passagens do 2-opt, W a largura SIMD e t o número de threads
+     * @throws std::invalid_argument se o grafo não é conexo
+     * @param circuit circuito encontrado como solução aproximada para o Travelling Salesperson Problem (TSP)
+     * @param incumbent melhor solução conhecida partilhada com outras execuções, à qual é proposto o circuito encontrado (opcional)
+     * @param warmStart circuito a usar como ponto de partida em vez do Nearest Neighbor, por exemplo o melhor circuito conhecido guardado em cache (opcional)
+     * @param threads número de threads (0 para usar todas as disponíveis)
+     * @return par cujo primeiro valor é o custo do circuito antes da otimização e o segundo valor é o custo do circuito depois da otimização
+     */
+    std::pair<double, double> tspBestImprovement(std::vector<unsigned> &circuit, Incumbent *incumbent = nullptr,
+                                                 const std::vector<unsigned> *warmStart = nullptr,
+                                                 unsigned threads = 0) const;
+
+    /**@brief Pós-otimiza um circuito através da programação dinâmica de Balas e Simonetti: determina o melhor circuito em que nenhum vértice passa à frente de outro que estava window ou mais posições depois dele.
+     *
+     * Se o grafo não for completo, a otimização corre sobre o fecho métrico do grafo e o circuito é expandido para usar apenas arestas reais.
+     *
+     * Complexidade Temporal: O(p V k<SUP>2</SUP> 2<SUP>k</SUP>), mais a do fecho métrico, sendo V o número de vértices do grafo, p o número de passagens e k a janela
+     * @throws std::invalid_argument se o grafo não é conexo ou o circuito não corresponde ao grafo
+     * @param circuit circuito a otimizar (por exemplo, o de tspTriangularApproximation ou o de tspHeuristic), substituído pelo circuito otimizado
+     * @param window janela k (entre 2 e 12)
+     * @return custo do circuito depois da otimização
+     */
+    double tspBalasSimonetti(std::vector<unsigned> &circuit, unsigned window = 8) const;
+
+    /**@brief Constrói um circuito através da heurística de Christofides: junta à Minimum Cost Spanning Tree (MST) do grafo um emparelhamento perfeito de custo mínimo dos vértices de grau ímpar, determina um circuito de Euler no multigrafo resultante e salta os vértices repetidos.
+     * O emparelhamento é determinado de forma gulosa e melhorado com trocas entre pares até um mínimo local.
+     *
+     * Complexidade Temporal: O(E log(V) + V<SUP>2</SUP> log(V) + m I), sendo V o número de vértices do grafo, E o número de arestas do grafo, m o número de pares de pares de vértices de grau ímpar e I o número de passagens de melhoria do emparelhamento
+     * @throws std::invalid_argument se o grafo não é conexo
+     * @param closure fecho métrico do grafo
+     * @return circuito construído (permutação dos vértices, sem repetir o vértice inicial no fim)
+     */
+    std::vector<unsigned> tspChristofides(const MetricClosure &closure) const;
 
 private:
     std::vector<Vertex *> vertexSet;
     unsigned edges = 0;
+    unsigned duplicates = 0;
+    EdgeIndex index;
+    std::vector<unsigned> originalIds;
+    std::vector<unsigned> internalIds;
 
     /**@brief Função auxiliar recursiva para resolver o Travelling Salesperson Problem (TSP) através de um algoritmo de backtracking.
      *
@@ -95,9 +275,10 @@ private:
      * @param currentPath circuito encontrado até ao momento
      * @param minCost custo mínimo do circuito encontrado até ao momento
      * @param circuit circuito encontrado como solução para o Travelling Salesperson Problem (TSP)
+     * @param incumbent melhor solução conhecida partilhada com outras execuções (opcional)
      */
     void tspBacktracking(unsigned currentIndex, double currentCost, std::vector<unsigned> &currentPath, double &minCost,
-                         std::vector<unsigned> &circuit) const;
+                         std::vector<unsigned> &circuit, Incumbent *incumbent) const;
 
     /**@brief Determina uma Minimum Cost Spanning Tree (MST) do grafo através do algoritmo de Prim.
      *
@@ -106,31 +287,70 @@ private:
      */
     std::pair<double, Graph> mstPrim() const;
 
+    /**@brief Determina um emparelhamento perfeito de custo (aproximadamente) mínimo dos vértices odd: emparelhamento guloso, melhorado com trocas 2-opt entre pares enquanto o custo diminuir.
+     *
+     * Complexidade Temporal: O(n<SUP>2</SUP> log(n) + n<SUP>2</SUP> I), sendo n o número de vértices a emparelhar e I o número de passagens de melhoria
+     * @param closure fecho métrico do grafo
+     * @param odd ids dos vértices a emparelhar (em número par)
+     * @return pares de vértices emparelhados
+     */
+    static std::vector<std::pair<unsigned, unsigned>>
+    perfectMatching(const MetricClosure &closure, const std::vector<unsigned> &odd);
+
     /**@brief Resolve (de forma aproximada) o Travelling Salesperson Problem (TSP) através da heurística Nearest Neighbor.
      *
      * Complexidade Temporal: O(V<SUP>2</SUP>), sendo V o número de vértices do grafo
+     * @param closure fecho métrico do grafo
      * @param circuit circuito encontrado como solução aproximada para o Travelling Salesperson Problem (TSP)
      * @return custo do circuito encontrado como solução aproximada para o Travelling Salesperson Problem (TSP)
      */
-    double tspNearestNeighbor(std::vector<unsigned> &circuit) const;
+    double tspNearestNeighbor(const MetricClosure &closure, std::vector<unsigned> &circuit) const;
 
-    /**@brief Realiza uma operação de troca 2-opt entre duas arestas do circuito para resolver (de forma aproximada) o Travelling Salesperson Problem (TSP).
+    /**@brief Constrói o circuito inicial das heurísticas de otimização: o circuito warmStart, se existir, ou o circuito da heurística Nearest Neighbor.
      *
-     * Complexidade Temporal: O(n), sendo n o tamanho do circuito encontrado antes da otimização
-     * @param cost custo do circuito encontrado antes da operação de troca
-     * @param circuit circuito encontrado antes da operação de troca
-     * @return par cujo primeiro valor é o custo do circuito encontrado depois da operação de troca o segundo valor é o circuito encontrado depois da operação de troca
+     * Complexidade Temporal: O(V<SUP>2</SUP>) sem warmStart, O(V + n) caso contrário, sendo V o número de vértices do grafo e n o tamanho de warmStart
+     * @throws std::invalid_argument se warmStart não corresponde ao grafo
+     * @param closure fecho métrico do grafo
+     * @param circuit circuito inicial
+     * @param warmStart circuito a usar como ponto de partida (pode repetir vértices, como os circuitos expandidos; só conta a primeira ocorrência de cada vértice) (opcional)
+     * @return custo do circuito inicial
+     */
+    double tspInitialCircuit(const MetricClosure &closure, std::vector<unsigned> &circuit,
+                             const std::vector<unsigned> *warmStart) const;
+
+    /**@brief Avalia a troca 2-opt que torna os vértices a e b adjacentes: remove as arestas de a e de b para os seus sucessores (ou antecessores) e liga a a b e os sucessores (ou antecessores) entre si.
+     *
+     * Complexidade Temporal: O(1)
+     * @param closure fecho métrico do grafo
+     * @param tour circuito (permutação dos vértices, sem repetir o vértice inicial no fim)
+     * @param pos posição de cada vértice no circuito
+     * @param a id do primeiro vértice
+     * @param b id do segundo vértice
+     * @param successor true para trocar as arestas para os sucessores, false para trocar as arestas para os antecessores
+     * @param i posição inicial do segmento a inverter (com LocalSearch::reverse) para aplicar a troca
+     * @param j posição final do segmento a inverter para aplicar a troca (igual a i se a troca não altera o circuito)
+     * @return variação do custo do circuito provocada pela troca
      */
-    std::pair<double, std::vector<unsigned>> tspTwoOptSwap(double cost, const std::vector<unsigned> &circuit) const;
+    static double
+    tspTwoOptMove(const MetricClosure &closure, const std::vector<unsigned> &tour, const std::vector<unsigned> &pos,
+                  unsigned a, unsigned b, bool successor, unsigned &i, unsigned &j);
 
-    /**@brief Otimiza uma solução aproximada encontrada para o Travelling Salesperson Problem (TSP) através da heurística Simulated Annealing.
+    /**@brief Otimiza uma solução aproximada encontrada para o Travelling Salesperson Problem (TSP) através da heurística Simulated Annealing, com trocas 2-opt entre cada vértice e um dos seus vizinhos mais próximos (ou, por vezes, um vértice aleatório).
+     * A temperatura inicial é calibrada a partir de uma amostra de trocas, de modo a aceitar metade das trocas que pioram o circuito, e desce geometricamente ao longo do orçamento (número de trocas ou tempo) até uma fração da inicial.
+     * Se o melhor circuito não melhorar durante uma fração do orçamento, a pesquisa recomeça a partir do melhor circuito com a temperatura aumentada (reaquecimento), que volta a descer progressivamente.
      *
-     * Complexidade Temporal: O(n<SUP>2</SUP>), sendo n o tamanho do circuito encontrado antes da otimização
+     * Complexidade Temporal: O(V<SUP>2</SUP> log(k) + m n), sendo V o número de vértices do grafo, k o número de vizinhos mais próximos, m o número de trocas e n o tamanho do circuito (no pior caso)
+     * @param closure fecho métrico do grafo
      * @param cost custo do circuito encontrado antes da otimização
      * @param circuit circuito a otimizar
+     * @param incumbent melhor solução conhecida partilhada com outras execuções, que define o prazo limite e o custo alvo a partir do qual pára (opcional)
+     * @param moves número de trocas a avaliar (0 para um orçamento proporcional ao número de vértices, ou ilimitado se seconds for positivo)
+     * @param seconds tempo a usar, em segundos (0 para usar apenas o número de trocas)
+     * @param seed semente do gerador de números aleatórios
      * @return custo do circuito depois da otimização
      */
-    double tspSimulatedAnnealing(double cost, std::vector<unsigned> &circuit) const;
+    double tspSimulatedAnnealing(const MetricClosure &closure, double cost, std::vector<unsigned> &circuit,
+                                 Incumbent *incumbent, unsigned long moves, double seconds, unsigned seed) const;
 };
 
 
@@ -0,0 +1,49 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#include "GraphCache.h"
+
+using namespace std;
+
+GraphCache::GraphCache(size_t budget) : budget(budget) {}
+
+bool GraphCache::take(const string &key, Graph &graph) {
+    auto position = positions.find(key);
+    if (position == positions.end())
+        return false;
+    graph = move(position->second->graph);
+    used -= position->second->memory;
+    entries.erase(position->second);
+    positions.erase(position);
+    return true;
+}
+
+bool GraphCache::put(const string &key, Graph graph) {
+    Graph previous;
+    take(key, previous);
+    size_t memory = graph.getMemoryUsage();
+    if (memory > budget)
+        return false;
+    while (used + memory > budget) {
+        used -= entries.back().memory;
+        positions.erase(entries.back().key);
+        entries.pop_back();
+    }
+    entries.push_front(Entry{key, move(graph), memory});
+    positions[key] = entries.begin();
+    used += memory;
+    return true;
+}
+
+unsigned GraphCache::size() const {
+    return entries.size();
+}
+
+size_t GraphCache::getMemoryUsage() const {
+    return used;
+}
+
+size_t GraphCache::getBudget() const {
+    return budget;
+}
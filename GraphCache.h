@@ -0,0 +1,77 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#ifndef TSP_GRAPHCACHE_H
+#define TSP_GRAPHCACHE_H
+
+
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include "Graph.h"
+
+class GraphCache {
+public:
+    /**@brief Construtor com parâmetros. Constrói uma cache de grafos já lidos, indexada pelo caminho dos ficheiros de dados e limitada a um orçamento de memória, com remoção do grafo usado há mais tempo (LRU).
+     *
+     * Complexidade Temporal: O(1)
+     * @param budget memória máxima ocupada pelos grafos guardados, em bytes
+     */
+    explicit GraphCache(std::size_t budget);
+
+    /**@brief Retira da cache o grafo guardado com a chave key, se existir.
+     *
+     * Complexidade Temporal: O(1) (em média)
+     * @param key chave (caminho dos ficheiros de dados)
+     * @param graph grafo retirado (se existir)
+     * @return true se o grafo existia na cache, false caso contrário
+     */
+    bool take(const std::string &key, Graph &graph);
+
+    /**@brief Guarda o grafo graph com a chave key, como o usado mais recentemente, removendo os grafos usados há mais tempo até caber no orçamento. Se o grafo sozinho exceder o orçamento, não é guardado.
+     *
+     * Complexidade Temporal: O(1) (em média) mais a libertação dos grafos removidos
+     * @param key chave (caminho dos ficheiros de dados)
+     * @param graph grafo a guardar
+     * @return true se o grafo foi guardado, false caso contrário
+     */
+    bool put(const std::string &key, Graph graph);
+
+    /**@brief Retorna o número de grafos guardados.
+     *
+     * Complexidade Temporal: O(1)
+     * @return número de grafos guardados
+     */
+    unsigned size() const;
+
+    /**@brief Retorna a memória ocupada pelos grafos guardados.
+     *
+     * Complexidade Temporal: O(1)
+     * @return memória ocupada, em bytes (estimativa, ver Graph::getMemoryUsage)
+     */
+    std::size_t getMemoryUsage() const;
+
+    /**@brief Retorna o orçamento de memória da cache.
+     *
+     * Complexidade Temporal: O(1)
+     * @return memória máxima ocupada pelos grafos guardados, em bytes
+     */
+    std::size_t getBudget() const;
+
+private:
+    struct Entry {
+        std::string key;
+        Graph graph;
+        std::size_t memory;
+    };
+
+    std::size_t budget;
+    std::size_t used = 0;
+    std::list<Entry> entries;
+    std::unordered_map<std::string, std::list<Entry>::iterator> positions;
+};
+
+
+#endif //TSP_GRAPHCACHE_H
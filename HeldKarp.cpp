@@ -0,0 +1,108 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#include "HeldKarp.h"
+#include <algorithm>
+#include <limits>
+
+using namespace std;
+
+#define STALL_ITERATIONS 10
+
+HeldKarp::HeldKarp(const MetricClosure &closure) : closure(closure), penalties(closure.size(), 0.0) {}
+
+double HeldKarp::solve(double upperBound, unsigned iterations) {
+    unsigned n = closure.size();
+    if (n < 3)
+        return bound = n == 2 ? 2 * closure.getDistance(0, 1) : 0.0;
+    fill(penalties.begin(), penalties.end(), 0.0);
+    bound = 0.0;
+    vector<int> degrees(n);
+    double lambda = 2.0;
+    unsigned stalled = 0;
+    for (unsigned iteration = 0; iteration < iterations && lambda > 1e-6; iteration++) {
+        double total = 0.0;
+        for (double penalty: penalties)
+            total += penalty;
+        double w = oneTree(degrees) - 2 * total;
+        if (w > bound) {
+            bound = w;
+            stalled = 0;
+        } else if (++stalled == STALL_ITERATIONS) {
+            lambda /= 2;
+            stalled = 0;
+        }
+        double norm = 0.0;
+        for (unsigned v = 0; v < n; v++)
+            norm += (double) (degrees[v] - 2) * (degrees[v] - 2);
+        if (norm == 0.0 || upperBound - w <= 0.0)
+            break;
+        double step = lambda * (upperBound - w) / norm;
+        for (unsigned v = 0; v < n; v++)
+            penalties[v] += step * (degrees[v] - 2);
+    }
+    return bound;
+}
+
+double HeldKarp::getBound() const {
+    return bound;
+}
+
+double HeldKarp::gap(double cost, double bound) {
+    return bound > 0.0 ? 100.0 * (cost - bound) / bound : numeric_limits<double>::infinity();
+}
+
+double HeldKarp::oneTree(vector<int> &degrees) const {
+    unsigned n = closure.size();
+    fill(degrees.begin(), degrees.end(), 0);
+    vector<double> key(n, numeric_limits<double>::infinity());
+    vector<unsigned> parent(n, 0);
+    vector<char> inTree(n, false);
+    double cost = 0.0;
+    unsigned current = 1;
+    inTree[1] = true;
+    for (unsigned added = 1; added < n - 1; added++) {
+        const double *row = closure.getRow(current);
+        unsigned next = 0;
+        double nearest = numeric_limits<double>::infinity();
+        for (unsigned v = 2; v < n; v++) {
+            if (inTree[v])
+                continue;
+            double d = row[v] + penalties[current] + penalties[v];
+            if (d < key[v]) {
+                key[v] = d;
+                parent[v] = current;
+            }
+            if (key[v] < nearest) {
+                nearest = key[v];
+                next = v;
+            }
+        }
+        inTree[next] = true;
+        cost += nearest;
+        degrees[next]++;
+        degrees[parent[next]]++;
+        current = next;
+    }
+
+    const double *row = closure.getRow(0);
+    double first = numeric_limits<double>::infinity(), second = first;
+    unsigned firstVertex = 1, secondVertex = 1;
+    for (unsigned v = 1; v < n; v++) {
+        double d = row[v] + penalties[0] + penalties[v];
+        if (d < first) {
+            second = first;
+            secondVertex = firstVertex;
+            first = d;
+            firstVertex = v;
+        } else if (d < second) {
+            second = d;
+            secondVertex = v;
+        }
+    }
+    degrees[0] = 2;
+    degrees[firstVertex]++;
+    degrees[secondVertex]++;
+    return cost + first + second;
+}
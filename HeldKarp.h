@@ -0,0 +1,62 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#ifndef TSP_HELDKARP_H
+#define TSP_HELDKARP_H
+
+
+#include <vector>
+#include "MetricClosure.h"
+
+class HeldKarp {
+public:
+    /**@brief Construtor com parâmetros. Prepara o cálculo do limite inferior de Held-Karp sobre closure.
+     *
+     * Complexidade Temporal: O(V), sendo V o número de vértices
+     * @param closure fecho métrico do grafo
+     */
+    explicit HeldKarp(const MetricClosure &closure);
+
+    /**@brief Determina o limite inferior de Held-Karp para o custo do circuito ótimo: maximiza, por otimização por subgradiente das penalidades dos vértices, o custo da 1-tree mínima (Minimum Cost Spanning Tree (MST) dos vértices 1..V-1, mais as duas arestas mais curtas do vértice 0) com as distâncias penalizadas.
+     * O passo é t = lambda (upperBound - w) / |g|<SUP>2</SUP>, sendo w o custo da 1-tree e g o desvio do grau de cada vértice em relação a 2; lambda é reduzido para metade quando o limite não melhora.
+     *
+     * Complexidade Temporal: O(I V<SUP>2</SUP>), sendo I o número de iterações e V o número de vértices
+     * @param upperBound custo de um circuito conhecido (limite superior para o custo do circuito ótimo)
+     * @param iterations número máximo de iterações
+     * @return limite inferior para o custo do circuito ótimo
+     */
+    double solve(double upperBound, unsigned iterations = 100);
+
+    /**@brief Retorna o melhor limite inferior determinado.
+     *
+     * Complexidade Temporal: O(1)
+     * @return melhor limite inferior determinado (0 se ainda não foi determinado)
+     */
+    double getBound() const;
+
+    /**@brief Calcula a diferença relativa (gap de otimalidade) entre o custo de um circuito e um limite inferior.
+     *
+     * Complexidade Temporal: O(1)
+     * @param cost custo do circuito
+     * @param bound limite inferior para o custo do circuito ótimo
+     * @return gap de otimalidade, em percentagem
+     */
+    static double gap(double cost, double bound);
+
+private:
+    const MetricClosure &closure;
+    std::vector<double> penalties;
+    double bound = 0.0;
+
+    /**@brief Determina a 1-tree mínima com as distâncias penalizadas e o grau de cada vértice nessa 1-tree.
+     *
+     * Complexidade Temporal: O(V<SUP>2</SUP>), sendo V o número de vértices
+     * @param degrees grau de cada vértice na 1-tree
+     * @return custo da 1-tree com as distâncias penalizadas
+     */
+    double oneTree(std::vector<int> &degrees) const;
+};
+
+
+#endif //TSP_HELDKARP_H
@@ -0,0 +1,57 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#include "Incumbent.h"
+#include <limits>
+
+using namespace std;
+
+Incumbent::Incumbent(chrono::steady_clock::time_point deadline) : bound(numeric_limits<double>::infinity()),
+                                                                  stopped(false),
+                                                                  target(-numeric_limits<double>::infinity()),
+                                                                  deadline(deadline) {}
+
+double Incumbent::getBound() const {
+    return bound.load(memory_order_relaxed);
+}
+
+bool Incumbent::expired() const {
+    return stopped.load(memory_order_relaxed) || chrono::steady_clock::now() >= deadline;
+}
+
+void Incumbent::stop() {
+    stopped.store(true, memory_order_relaxed);
+}
+
+void Incumbent::setTarget(double target) {
+    this->target.store(target, memory_order_relaxed);
+}
+
+bool Incumbent::reached(double cost) const {
+    return cost <= target.load(memory_order_relaxed);
+}
+
+bool Incumbent::offer(double cost, const vector<unsigned> &circuit, const string &algorithm) {
+    if (reached(cost))
+        stop();
+    if (cost >= getBound())
+        return false;
+    lock_guard<std::mutex> lock(mutex);
+    if (cost >= bound.load(memory_order_relaxed))
+        return false;
+    this->circuit = circuit;
+    this->algorithm = algorithm;
+    bound.store(cost, memory_order_relaxed);
+    return true;
+}
+
+vector<unsigned> Incumbent::getCircuit() const {
+    lock_guard<std::mutex> lock(mutex);
+    return circuit;
+}
+
+string Incumbent::getAlgorithm() const {
+    lock_guard<std::mutex> lock(mutex);
+    return algorithm;
+}
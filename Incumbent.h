@@ -0,0 +1,94 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#ifndef TSP_INCUMBENT_H
+#define TSP_INCUMBENT_H
+
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <vector>
+
+class Incumbent {
+public:
+    /**@brief Construtor com parâmetros. Constrói a melhor solução conhecida (ainda inexistente) partilhada entre execuções concorrentes, com um prazo limite.
+     *
+     * Complexidade Temporal: O(1)
+     * @param deadline instante a partir do qual as execuções devem parar e devolver a melhor solução encontrada
+     */
+    explicit Incumbent(std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max());
+
+    /**@brief Retorna o custo da melhor solução conhecida, que é um limite superior para o custo do circuito ótimo.
+     *
+     * Complexidade Temporal: O(1)
+     * @return custo da melhor solução conhecida (infinito se ainda não existe nenhuma)
+     */
+    double getBound() const;
+
+    /**@brief Indica se as execuções devem parar, i. e., se o prazo limite já foi ultrapassado ou se alguma execução provou que a melhor solução conhecida é ótima.
+     *
+     * Complexidade Temporal: O(1)
+     * @return true se as execuções devem parar, false caso contrário
+     */
+    bool expired() const;
+
+    /**@brief Indica a todas as execuções que devem parar (por exemplo, porque a melhor solução conhecida foi provada ótima).
+     *
+     * Complexidade Temporal: O(1)
+     */
+    void stop();
+
+    /**@brief Define o custo alvo: um circuito com custo menor ou igual é considerado suficientemente bom (por exemplo, por estar a menos de um dado gap de um limite inferior) e as execuções devem parar.
+     *
+     * Complexidade Temporal: O(1)
+     * @param target custo alvo
+     */
+    void setTarget(double target);
+
+    /**@brief Indica se o custo cost atinge o custo alvo.
+     *
+     * Complexidade Temporal: O(1)
+     * @param cost custo de um circuito
+     * @return true se cost é menor ou igual ao custo alvo, false caso contrário
+     */
+    bool reached(double cost) const;
+
+    /**@brief Propõe o circuito circuit, de custo cost, encontrado pelo algoritmo algorithm. O circuito só é aceite se for melhor do que a melhor solução conhecida. Se o custo do circuito atingir o custo alvo, indica a todas as execuções que devem parar.
+     *
+     * Complexidade Temporal: O(n), sendo n o tamanho do circuito, se o circuito for aceite, O(1) caso contrário
+     * @param cost custo do circuito proposto
+     * @param circuit circuito proposto
+     * @param algorithm nome do algoritmo que encontrou o circuito
+     * @return true se o circuito foi aceite como nova melhor solução, false caso contrário
+     */
+    bool offer(double cost, const std::vector<unsigned> &circuit, const std::string &algorithm);
+
+    /**@brief Retorna o circuito da melhor solução conhecida.
+     *
+     * Complexidade Temporal: O(n), sendo n o tamanho do circuito
+     * @return circuito da melhor solução conhecida
+     */
+    std::vector<unsigned> getCircuit() const;
+
+    /**@brief Retorna o nome do algoritmo que encontrou a melhor solução conhecida.
+     *
+     * Complexidade Temporal: O(1)
+     * @return nome do algoritmo que encontrou a melhor solução conhecida
+     */
+    std::string getAlgorithm() const;
+
+private:
+    std::atomic<double> bound;
+    std::atomic<bool> stopped;
+    std::atomic<double> target;
+    std::chrono::steady_clock::time_point deadline;
+    mutable std::mutex mutex;
+    std::vector<unsigned> circuit;
+    std::string algorithm;
+};
+
+
+#endif //TSP_INCUMBENT_H
@@ -0,0 +1,126 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#include "LocalSearch.h"
+#include "DistancePolicy.h"
+#include "MetricSolver.h"
+#include "Simd.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <tuple>
+
+#define BEST_IMPROVEMENT_EPSILON 1e-9
+
+using namespace std;
+
+LocalSearch::LocalSearch(const MetricClosure &closure, unsigned neighbors)
+        : closure(closure), count(closure.size() > 1 ? min(neighbors, closure.size() - 1) : 0),
+          neighbors(MetricSolver::nearestNeighbors(MatrixDistance(closure), neighbors)) {}
+
+double LocalSearch::twoOpt(vector<unsigned> &tour, double target) const {
+    return MetricSolver::twoOpt(MatrixDistance(closure), neighbors, tour, target);
+}
+
+const unsigned *LocalSearch::getNeighbors(unsigned v) const {
+    return neighbors.data() + (size_t) v * count;
+}
+
+unsigned LocalSearch::getNeighborCount() const {
+    return count;
+}
+
+void LocalSearch::reverse(vector<unsigned> &tour, vector<unsigned> &pos, unsigned i, unsigned j) {
+    unsigned n = tour.size();
+    unsigned length = (j + n - i) % n + 1;
+    if (2 * length > n) {
+        unsigned first = (j + 1) % n;
+        j = (i + n - 1) % n;
+        i = first;
+        length = n - length;
+    }
+    for (unsigned s = 0; s < length / 2; s++) {
+        unsigned u = tour[i];
+        unsigned v = tour[j];
+        tour[i] = v;
+        pos[v] = i;
+        tour[j] = u;
+        pos[u] = j;
+        i = i + 1 == n ? 0 : i + 1;
+        j = j == 0 ? n - 1 : j - 1;
+    }
+}
+
+double LocalSearch::bestImprovement(const MetricClosure &closure, vector<unsigned> &circuit, unsigned threads) {
+    unsigned n = circuit.size() - 1;
+    if (circuit.size() < 5)
+        return closure.cost(circuit);
+    size_t stride = n + 1;
+    vector<float> matrix(stride * stride);
+    vector<float> edges(stride);
+    vector<float> gains(n);
+    vector<unsigned> partners(n);
+    vector<char> used(n);
+    vector<tuple<double, unsigned, unsigned>> moves;
+    ThreadPool pool(threads);
+    unsigned chunks = pool.size();
+    while (true) {
+        for (unsigned t = 0; t < chunks; t++) {
+            pool.submit([t, chunks, n, stride, &closure, &circuit, &matrix] {
+                for (unsigned a = t; a <= n; a += chunks) {
+                    const double *row = closure.getRow(circuit[a]);
+                    float *gathered = matrix.data() + a * stride;
+                    for (unsigned b = 0; b <= n; b++)
+                        gathered[b] = (float) row[circuit[b]];
+                }
+            });
+        }
+        pool.wait();
+        for (unsigned k = 0; k < n; k++)
+            edges[k] = matrix[k * stride + k + 1];
+        for (unsigned t = 0; t < chunks; t++) {
+            pool.submit([t, chunks, n, stride, &matrix, &edges, &gains, &partners] {
+                for (unsigned i = t; i < n; i += chunks) {
+                    gains[i] = 0.0f;
+                    unsigned last = i == 0 ? n - 2 : n - 1;
+                    if (i + 2 > last)
+                        continue;
+                    unsigned position = 0;
+                    gains[i] = simdBestGain(edges[i], edges.data() + i + 2, matrix.data() + i * stride + i + 2,
+                                            matrix.data() + (i + 1) * stride + i + 3, last - i - 1, 0.0f, position);
+                    partners[i] = i + 2 + position;
+                }
+            });
+        }
+        pool.wait();
+
+        moves.clear();
+        for (unsigned i = 0; i < n; i++) {
+            if (gains[i] <= 0.0f)
+                continue;
+            unsigned j = partners[i];
+            double gain = closure.getDistance(circuit[i], circuit[i + 1]) +
+                          closure.getDistance(circuit[j], circuit[j + 1]) -
+                          closure.getDistance(circuit[i], circuit[j]) -
+                          closure.getDistance(circuit[i + 1], circuit[j + 1]);
+            if (gain > BEST_IMPROVEMENT_EPSILON)
+                moves.emplace_back(gain, i, j);
+        }
+        if (moves.empty())
+            break;
+        sort(moves.begin(), moves.end(), [](const tuple<double, unsigned, unsigned> &a,
+                                            const tuple<double, unsigned, unsigned> &b) {
+            return get<0>(a) > get<0>(b);
+        });
+        fill(used.begin(), used.end(), false);
+        for (const auto &move: moves) {
+            unsigned i = get<1>(move);
+            unsigned j = get<2>(move);
+            if (find(used.begin() + i, used.begin() + j + 1, true) != used.begin() + j + 1)
+                continue;
+            fill(used.begin() + i, used.begin() + j + 1, true);
+            std::reverse(circuit.begin() + i + 1, circuit.begin() + j + 1);
+        }
+    }
+    return closure.cost(circuit);
+}
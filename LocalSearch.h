@@ -0,0 +1,74 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#ifndef TSP_LOCALSEARCH_H
+#define TSP_LOCALSEARCH_H
+
+
+#include <vector>
+#include "MetricClosure.h"
+
+class LocalSearch {
+public:
+    /**@brief Construtor com parâmetros. Prepara a pesquisa local sobre closure, determinando para cada vértice a lista dos seus neighbors vizinhos mais próximos (lista de candidatos).
+     *
+     * Complexidade Temporal: O(V<SUP>2</SUP> log(k)), sendo V o número de vértices e k o número de vizinhos
+     * @param closure fecho métrico do grafo
+     * @param neighbors número de vizinhos mais próximos a considerar para cada vértice
+     */
+    explicit LocalSearch(const MetricClosure &closure, unsigned neighbors = 10);
+
+    /**@brief Otimiza o circuito tour até um ótimo local 2-opt (restrito às listas de candidatos), usando don't-look bits. Pode ser usado concorrentemente por várias threads, com circuitos diferentes.
+     *
+     * Complexidade Temporal: O(m n), sendo m o número de melhorias e n o tamanho do circuito (no pior caso)
+     * @param tour circuito a otimizar (permutação dos vértices, sem repetir o vértice inicial no fim)
+     * @param target custo alvo: pára assim que o custo do circuito for menor ou igual (opcional)
+     * @return custo do circuito depois da otimização
+     */
+    double twoOpt(std::vector<unsigned> &tour, double target = 0.0) const;
+
+    /**@brief Retorna os vizinhos mais próximos do vértice de id v, por ordem crescente de distância.
+     *
+     * Complexidade Temporal: O(1)
+     * @param v id do vértice
+     * @return apontador para o início da lista de vizinhos mais próximos (com getNeighborCount() elementos)
+     */
+    const unsigned *getNeighbors(unsigned v) const;
+
+    /**@brief Retorna o número de vizinhos mais próximos guardados para cada vértice.
+     *
+     * Complexidade Temporal: O(1)
+     * @return número de vizinhos mais próximos de cada vértice
+     */
+    unsigned getNeighborCount() const;
+
+    /**@brief Inverte, de forma cíclica, o segmento do circuito tour entre as posições i e j (inclusive), atualizando as posições pos dos vértices. Se o segmento tiver mais de metade do circuito, inverte o complemento, que produz o mesmo circuito.
+     *
+     * Complexidade Temporal: O(n), sendo n o tamanho do circuito
+     * @param tour circuito
+     * @param pos posição de cada vértice no circuito
+     * @param i posição inicial do segmento
+     * @param j posição final do segmento
+     */
+    static void reverse(std::vector<unsigned> &tour, std::vector<unsigned> &pos, unsigned i, unsigned j);
+
+    /**@brief Otimiza o circuito circuit até um ótimo local 2-opt (sobre todos os pares de arestas), de forma determinística, aplicando em cada passagem as melhores trocas.
+     * Em cada passagem, as distâncias são copiadas para uma matriz de floats pela ordem do circuito, de modo que os ganhos das trocas de cada aresta com todas as outras se calculam sobre linhas contíguas, com instruções SIMD. As arestas são repartidas pelas threads; depois, são aplicadas, por ordem decrescente de ganho (confirmado em double), as trocas que não se sobrepõem.
+     *
+     * Complexidade Temporal: O(p V<SUP>2</SUP> / (W t)), sendo p o número de passagens, V o número de vértices, W a largura SIMD e t o número de threads
+     * @param closure fecho métrico do grafo
+     * @param circuit circuito a otimizar (começa e acaba no vértice 0)
+     * @param threads número de threads (0 para usar todas as disponíveis)
+     * @return custo do circuito depois da otimização
+     */
+    static double bestImprovement(const MetricClosure &closure, std::vector<unsigned> &circuit, unsigned threads = 0);
+
+private:
+    const MetricClosure &closure;
+    unsigned count;
+    std::vector<unsigned> neighbors;
+};
+
+
+#endif //TSP_LOCALSEARCH_H
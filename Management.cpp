@@ -3,12 +3,37 @@
 //
 
 #include "Management.h"
-#include <fstream>
+#include "Portfolio.h"
+#include "MemeticSolver.h"
+#include "AntColony.h"
+#include "Decomposition.h"
+#include "TourConstruction.h"
+#include "LocalSearch.h"
+#include "HeldKarp.h"
+#include "TourMerging.h"
+#include "ThreadPool.h"
+#include "SubInstance.h"
+#include "TourCache.h"
+#include "MetricSolver.h"
+#include "SmallTsp.h"
+#include "MemoryProfiler.h"
+#include "ResultsLog.h"
+#include "TsplibInstance.h"
+#include "DistanceStore.h"
 #include <iostream>
+#include <sstream>
 #include <iomanip>
-#include <list>
+#include <limits>
 #include <stdexcept>
 #include <chrono>
+#include <thread>
+#include <algorithm>
+
+#define MEBIBYTE 1048576.0
+#define TSPLIB_NEIGHBORS 10u
+#define TSPLIB_MAX_PRINTED 1000u
+#define PACKED_NEIGHBORS 10u
+#define PACKED_MAX_PRINTED 1000u
 
 using namespace std;
 
@@ -63,15 +88,30 @@ int Management::validateInt(int n, const unordered_set<int> &valid) {
 }
 
 bool Management::menu() {
+    if (loader && loader->ready())
+        finishLoading();
+    if (loader)
+        cout << "\n(A carregar os dados em segundo plano: " << (int) (100.0 * loader->getProgress()) << "%)";
     cout << "\nMenu Principal:\n"
             "1 - Ler ficheiros de dados\n"
             "2 - Usar o algoritmo de 'backtracking'\n"
             "3 - Usar a heurística de aproximação triangular\n"
             "4 - Usar a nossa heurística\n"
+            "5 - Usar um portfólio de algoritmos em paralelo\n"
+            "6 - Usar o algoritmo memético\n"
+            "7 - Usar a otimização por colónia de formigas\n"
+            "8 - Usar a decomposição geográfica (grafos muito grandes)\n"
+            "9 - Usar uma construção (Greedy Edge ou Christofides) com 2-opt\n"
+            "10 - Usar várias execuções da nossa heurística em paralelo, com fusão dos circuitos\n"
+            "11 - Atualizar um circuito (inserir ou remover nós)\n"
+            "12 - Resolver o problema para um subconjunto dos nós\n"
+            "13 - Usar Nearest Neighbor, aproximação triangular e 2-opt especializados para a métrica do grafo\n"
+            "14 - Resolver uma instância TSPLIB (EUC_2D, CEIL_2D, GEO, ATT ou EXPLICIT)\n"
+            "15 - Resolver um grafo completo grande com as distâncias compactadas (sem ler o grafo)\n"
             "0 - Sair\n"
             "Opção: ";
     int option = readInt();
-    option = validateInt(option, 0, 4);
+    option = validateInt(option, 0, 15);
     if (option == 1)
         readDataset();
     else if (option == 2)
@@ -80,126 +120,35 @@ bool Management::menu() {
         triangularApproximationHeuristic();
     else if (option == 4)
         ourHeuristic();
+    else if (option == 5)
+        portfolioSolver();
+    else if (option == 6)
+        memeticAlgorithm();
+    else if (option == 7)
+        antColonyOptimization();
+    else if (option == 8)
+        decompositionHeuristic();
+    else if (option == 9)
+        constructionHeuristic();
+    else if (option == 10)
+        tourMergingHeuristic();
+    else if (option == 11)
+        dynamicTourUpdates();
+    else if (option == 12)
+        subsetHeuristic();
+    else if (option == 13)
+        metricHeuristic();
+    else if (option == 14)
+        tsplibHeuristic();
+    else if (option == 15)
+        packedHeuristic();
     else
         return false;
     return true;
 }
 
-bool Management::readNodesFile() {
-    ifstream in("../files/" + nodesFile);
-    if (!in.is_open()) {
-        cout << "Erro ao abrir o ficheiro " << nodesFile << "." << endl;
-        cout << "Verifique se o ficheiro se encontra dentro do diretório files." << endl;
-        return false;
-    }
-    cout << "\nA ler ficheiro " << nodesFile << "..." << endl;
-    string line;
-    getline(in, line);
-    unsigned errors = 0;
-    while (getline(in, line)) {
-        istringstream iss(line);
-        string field;
-        vector<string> fields(3);
-        unsigned f = 0;
-        while (getline(iss, field, ','))
-            fields[f++] = field;
-        unsigned id = stoul(fields[0]);
-        double longitude = stod(fields[1]);
-        double latitude = stod(fields[2]);
-        if (!graph.addVertex(id, longitude, latitude))
-            errors++;
-    }
-    cout << "Leitura do ficheiro " << nodesFile << " bem-sucedida!" << endl;
-    cout << "Foram lidos " << graph.size() << " nós e ocorreram " << errors << " erros.";
-    return true;
-}
-
-bool Management::readEdgesFile() {
-    ifstream in("../files/" + edgesFile);
-    if (!in.is_open()) {
-        cout << "Erro ao abrir o ficheiro " << edgesFile << "." << endl;
-        cout << "Verifique se o ficheiro se encontra dentro do diretório files." << endl;
-        return false;
-    }
-    cout << "\nA ler ficheiro " << edgesFile << "..." << endl;
-    string line;
-    getline(in, line);
-    unsigned counter = 0;
-    unsigned errors = 0;
-    while (getline(in, line)) {
-        istringstream iss(line);
-        string field;
-        vector<string> fields(3);
-        unsigned f = 0;
-        while (getline(iss, field, ','))
-            fields[f++] = field;
-        unsigned orig = stoul(fields[0]);
-        unsigned dest = stoul(fields[1]);
-        double distance = stod(fields[2]);
-        if (graph.addEdge(orig, dest, distance))
-            counter++;
-        else
-            errors++;
-    }
-    cout << "Leitura do ficheiro " << edgesFile << " bem-sucedida!" << endl;
-    cout << "Foram lidas " << counter << " arestas e ocorreram " << errors << " erros." << endl;
-    return true;
-}
-
-bool Management::readGraphFile(bool header) {
-    ifstream in("../files/" + graphFile);
-    if (!in.is_open()) {
-        cout << "Erro ao abrir o ficheiro " << graphFile << "." << endl;
-        cout << "Verifique se o ficheiro se encontra dentro do diretório files." << endl;
-        return false;
-    }
-    cout << "\nA ler ficheiro " << graphFile << "..." << endl;
-    string line;
-    if (header)
-        getline(in, line);
-    unsigned counter = 0;
-    unsigned errors = 0;
-    unsigned last = 0;
-    list<pair<unsigned, unsigned>> edges;
-    list<double> distances;
-    while (getline(in, line)) {
-        istringstream iss(line);
-        string field;
-        vector<string> fields(3);
-        unsigned f = 0;
-        while (f < 3 && getline(iss, field, ','))
-            fields[f++] = field;
-        unsigned orig = stoul(fields[0]);
-        unsigned dest = stoul(fields[1]);
-        last = max(last, orig);
-        last = max(last, dest);
-        double distance = stod(fields[2]);
-        edges.emplace_back(orig, dest);
-        distances.push_back(distance);
-    }
-    if (edges.size() != distances.size())
-        throw logic_error("O número de arestas não corresponde com o número de distâncias");
-    for (unsigned i = 0; i <= last; i++)
-        graph.addVertex(i);
-    auto edge = edges.begin();
-    auto distance = distances.begin();
-    for (; edge != edges.end() && distance != distances.end(); edge++, distance++)
-        if (graph.addEdge(edge->first, edge->second, *distance))
-            counter++;
-        else
-            errors++;
-    cout << "Leitura do ficheiro " << graphFile << " bem-sucedida!" << endl;
-    cout << "Foram lidos " << graph.size() << " nós e " << counter << " arestas e ocorreram " << errors << " erros."
-         << endl;
-    return true;
-}
-
 void Management::readDataset() {
-    if (graph.size()) {
-        cout << "A limpar dados..." << endl;
-        graph.clear();
-        filesRead = false;
-    }
+    finishLoading();
     cout << "\nGrafo a Ler:\n"
             "1 - Toy\n"
             "2 - Medium-Size\n"
@@ -213,10 +162,60 @@ void Management::readDataset() {
         readMediumSizeGraph();
     else
         readRealWorldGraph();
+}
+
+void Management::loadDataset(const string &nodesFile, const string &edgesFile, bool header, bool hilbert) {
+    string key = nodesFile.empty() ? edgesFile : nodesFile + ";" + edgesFile + (hilbert ? ";hilbert" : "");
+    if (filesRead && graph.size()) {
+        graphs.put(dataset, move(graph));
+    } else if (graph.size()) {
+        cout << "A limpar dados..." << endl;
+        graph.clear();
+    }
+    filesRead = false;
+    lowerBound = 0.0;
+    dynamicTour.reset();
+    dataset = key;
+    if (graphs.take(key, graph)) {
+        filesRead = true;
+        cout << "\nGrafo obtido da cache em memória (outros grafos em cache: " << graphs.size() << ", a ocupar cerca de "
+             << graphs.getMemoryUsage() / (1 << 20) << " de " << graphs.getBudget() / (1 << 20) << " MiB)." << endl;
+        describeDataset();
+        return;
+    }
+    loader.reset(new DatasetLoader(graph, nodesFile, edgesFile, header, hilbert));
+    cout << "\nA carregar os dados em segundo plano (os algoritmos esperam que o carregamento termine)..." << endl;
+}
+
+void Management::finishLoading() {
+    if (!loader)
+        return;
+    bool waited = false;
+    while (!loader->ready()) {
+        cout << "\rA carregar os dados... " << (int) (100.0 * loader->getProgress()) << "%" << flush;
+        this_thread::sleep_for(chrono::milliseconds(100));
+        waited = true;
+    }
+    if (waited)
+        cout << "\rA carregar os dados... 100%" << endl;
+    filesRead = loader->wait();
+    cout << loader->getReport();
+    cout << "Os dados foram carregados em cerca de " << loader->getMilliseconds() << " milissegundos." << endl;
+    long milliseconds = loader->getMilliseconds();
+    loader.reset();
+    if (filesRead) {
+        describeDataset();
+        reportMemory("carregamento", 0.0, milliseconds);
+    }
+}
+
+void Management::describeDataset() {
     if (graph.isComplete())
         cout << "\nO grafo é completo." << endl;
     else
         cout << "\nO grafo NÃO é completo." << endl;
+    metric = selectMetric(graph, geometric);
+    cout << "Métrica de distância para os algoritmos especializados: " << metricName(metric) << "." << endl;
 }
 
 void Management::readToyGraph() {
@@ -234,8 +233,8 @@ void Management::readToyGraph() {
         path += "/stadiums.csv";
     else
         path += "/tourism.csv";
-    graphFile = path;
-    filesRead = readGraphFile(true);
+    geometric = false;
+    loadDataset("", path, true, false);
 }
 
 void Management::readMediumSizeGraph() {
@@ -252,8 +251,8 @@ void Management::readMediumSizeGraph() {
     for (auto it = n.rbegin(); it != n.rend(); it++)
         path += *it;
     path += ".csv";
-    graphFile = path;
-    filesRead = readGraphFile(false);
+    geometric = false;
+    loadDataset("", path, false, false);
 }
 
 void Management::readRealWorldGraph() {
@@ -262,52 +261,140 @@ void Management::readRealWorldGraph() {
     int option = readInt();
     option = validateInt(option, 1, 3);
     path += (char) ('0' + option);
-    nodesFile = path + "/nodes.csv";
-    edgesFile = path + "/edges.csv";
-    bool nodesRead = readNodesFile();
-    cout << endl;
-    bool edgesRead = readEdgesFile();
-    cout << endl;
-    filesRead = nodesRead && edgesRead;
+    cout << "Reordenar os nós ao longo de uma curva de Hilbert (1 - Sim, 0 - Não)? ";
+    int reorder = readInt();
+    reorder = validateInt(reorder, 0, 1);
+    cout << "Usar a distância geográfica entre as coordenadas nos algoritmos especializados, em vez dos pesos das arestas (1 - Sim, 0 - Não)? ";
+    int distance = readInt();
+    geometric = validateInt(distance, 0, 1);
+    loadDataset(path + "/nodes.csv", path + "/edges.csv", true, reorder);
 }
 
 void Management::checkDataset() {
+    finishLoading();
     while (!filesRead) {
         cout
                 << "Ainda não leu os ficheiros de dados (ou ocorreu um erro durante a leitura), pelo que não existem dados para analisar."
                 << endl;
         cout << endl;
         readDataset();
+        finishLoading();
     }
+    MemoryProfiler::takePhases();
+}
+
+double Management::heldKarpBound() {
+    if (lowerBound > 0.0)
+        return lowerBound;
+    auto start = chrono::high_resolution_clock::now();
+    MetricClosure closure(graph);
+    if (!closure.isConnected())
+        return 0.0;
+    vector<unsigned> tour = TourConstruction::greedyEdge(closure);
+    double upperBound = LocalSearch(closure).twoOpt(tour);
+    lowerBound = HeldKarp(closure).solve(upperBound);
+    auto end = chrono::high_resolution_clock::now();
+    cout << "\nO limite inferior de Held-Karp (" << lowerBound << ") demorou cerca de "
+         << (end - start) / chrono::milliseconds(1) << " milissegundos a calcular." << endl;
+    return lowerBound;
+}
+
+double Management::readTarget() {
+    cout << "Gap de otimalidade aceitável, em % do limite inferior de Held-Karp (0 para não parar mais cedo): ";
+    int gap = readInt();
+    gap = validateInt(gap, 0, 100);
+    return gap ? heldKarpBound() * (1.0 + gap / 100.0) : 0.0;
+}
+
+void Management::printGap(double cost) {
+    double bound = heldKarpBound();
+    if (bound > 0.0)
+        cout << "O custo do circuito está a, no máximo, " << HeldKarp::gap(cost, bound)
+             << "% do ótimo (limite inferior de Held-Karp: " << bound << ")." << endl;
+}
+
+unsigned Management::readWindow() {
+    cout << "Janela da pós-otimização de Balas-Simonetti (0 para não pós-otimizar, 2 a 12): ";
+    int window = readInt();
+    return validateInt(window, 0, 12);
+}
+
+void Management::postOptimize(vector<unsigned> &path, double &cost, unsigned window) {
+    if (!window)
+        return;
+    auto start = chrono::high_resolution_clock::now();
+    double optimized = graph.tspBalasSimonetti(path, window);
+    auto end = chrono::high_resolution_clock::now();
+    cout << "\nA pós-otimização de Balas-Simonetti (janela " << max(window, 2u) << ") reduziu o custo do circuito de "
+         << cost << " para " << optimized << " (" << 100.0 * (cost - optimized) / cost << "%), em cerca de "
+         << (end - start) / chrono::milliseconds(1) << " milissegundos." << endl;
+    cost = optimized;
+}
+
+void Management::reportMemory(const string &algorithm, double cost, long milliseconds) {
+    vector<MemoryProfiler::Phase> phases;
+    for (const auto &phase: MemoryProfiler::takePhases()) {
+        auto it = find_if(phases.begin(), phases.end(), [&phase](const MemoryProfiler::Phase &other) {
+            return other.name == phase.name;
+        });
+        if (it == phases.end()) {
+            phases.push_back(phase);
+            continue;
+        }
+        it->allocations += phase.allocations;
+        it->deallocations += phase.deallocations;
+        it->bytes += phase.bytes;
+        it->peakRss = max(it->peakRss, phase.peakRss);
+        it->milliseconds += phase.milliseconds;
+    }
+    cout << "\nMemória do grafo: " << graph.getVertexMemoryUsage() << " bytes por nó e "
+         << graph.getEdgeMemoryUsage() << " bytes por aresta (cerca de " << fixed << setprecision(1)
+         << graph.getMemoryUsage() / MEBIBYTE << " MiB no total)." << endl;
+    for (const auto &phase: phases)
+        cout << "Fase " << phase.name << ": " << phase.allocations << " alocações (" << phase.bytes / MEBIBYTE
+             << " MiB) e " << phase.deallocations << " libertações, pico de RSS de " << phase.peakRss / 1024.0
+             << " MiB, " << phase.milliseconds << " milissegundos." << endl;
+    cout << defaultfloat << setprecision(6);
+    ResultsLog results;
+    if (results.append(dataset, algorithm, cost, milliseconds, graph, phases))
+        cout << "Os resultados foram acrescentados a " << results.getPath() << "." << endl;
 }
 
 void Management::backtrackingAlgorithm() {
     checkDataset();
     vector<unsigned> path;
     auto start = chrono::high_resolution_clock::now();
+    MemoryProfiler::Scope scope("resolução");
     double cost = graph.tspBacktracking(path);
+    scope.stop();
     auto end = chrono::high_resolution_clock::now();
     cout
             << "\nDe acordo com o algoritmo de backtracking, o circuito que visita todos os nós do grafo com custo mínimo agregado é "
             << endl;
     for (unsigned p: path)
-        cout << " -> " << p;
+        cout << " -> " << graph.getOriginalId(p);
     cout << "\nO custo do circuito é " << cost << "." << endl;
-    cout << "\nO algoritmo demorou cerca de " << (end - start) / chrono::milliseconds(1) << " milissegundos a executar."
-         << endl;
+    if (SmallTsp::supports(graph.size()))
+        cout << "\nO algoritmo demorou cerca de " << (end - start) / chrono::microseconds(1)
+             << " microssegundos a executar." << endl;
+    else
+        cout << "\nO algoritmo demorou cerca de " << (end - start) / chrono::milliseconds(1)
+             << " milissegundos a executar." << endl;
+    reportMemory("backtracking", cost, (long) ((end - start) / chrono::milliseconds(1)));
 }
 
 void Management::triangularApproximationHeuristic() {
     checkDataset();
+    cout << endl;
+    unsigned window = readWindow();
     vector<unsigned> path;
     auto start = chrono::high_resolution_clock::now();
     pair<double, double> circuit;
     try {
         circuit = graph.tspTriangularApproximation(path);
     } catch (invalid_argument &) {
-        cout
-                << "\nA heurística de aproximação triangular não funciona para o grafo em análise. O grafo não verifica a desigualdade triangular."
-                << endl;
+        cout << "\nA heurística de aproximação triangular não funciona para o grafo em análise. O grafo não é conexo."
+             << endl;
         return;
     }
     auto end = chrono::high_resolution_clock::now();
@@ -315,36 +402,658 @@ void Management::triangularApproximationHeuristic() {
             << "\nDe acordo com a heurística de aproximação triangular, o circuito que visita todos os nós do grafo com custo mínimo agregado é "
             << endl;
     for (unsigned p: path)
-        cout << " -> " << p;
+        cout << " -> " << graph.getOriginalId(p);
     double mst = circuit.first;
     double cost = circuit.second;
+    if (window) {
+        cout << "\nO custo do circuito antes da pós-otimização é " << cost << "." << endl;
+        postOptimize(path, cost, window);
+        cout << "\nO circuito pós-otimizado é " << endl;
+        for (unsigned p: path)
+            cout << " -> " << graph.getOriginalId(p);
+    }
     cout << "\nO custo da Minimum Cost Spanning Tree (MST) determinada para a heurística é " << mst
          << ". Este custo é um limite inferior para o custo do circuito." << endl;
     cout << "O custo do circuito é " << cost << "." << endl;
+    printGap(cost);
     cout << "\nO algoritmo demorou cerca de " << (end - start) / chrono::milliseconds(1) << " milissegundos a executar."
          << endl;
+    reportMemory("aproximação triangular", cost, (long) ((end - start) / chrono::milliseconds(1)));
 }
 
 void Management::ourHeuristic() {
     checkDataset();
-    if (!graph.isComplete()) {
-        cout << "\nA nossa heurística não funciona para o grafo em análise. O grafo não é completo." << endl;
+    cout << endl;
+    Incumbent incumbent;
+    double target = readTarget();
+    incumbent.setTarget(target);
+    cout << "Otimização (1 - Simulated Annealing com 2-opt; 2 - 2-opt de melhor melhoria, determinístico): ";
+    int mode = readInt();
+    mode = validateInt(mode, 1, 2);
+    bool annealing = mode == 1;
+    int seconds = 0;
+    if (annealing) {
+        cout << "Tempo para o Simulated Annealing, em segundos (0 para um número de trocas proporcional ao número de nós): ";
+        seconds = readInt();
+        seconds = validateInt(seconds, 0, 3600);
+    }
+    unsigned window = readWindow();
+    string optimization = annealing ? "Simulated Annealing (2-opt)" : "2-opt de melhor melhoria";
+    ostringstream params;
+    params << "heuristica;alvo=" << setprecision(17) << target;
+    if (annealing)
+        params << ";tempo=" << seconds;
+    else
+        params << ";otimizacao=melhor";
+    if (window)
+        params << ";janela=" << window;
+    vector<unsigned> path;
+    auto start = chrono::high_resolution_clock::now();
+    TourCache cache(graph);
+    double cached;
+    if (cache.lookup(params.str(), path, cached)) {
+        auto end = chrono::high_resolution_clock::now();
+        cout << "\nCircuito obtido da cache (impressão digital do grafo " << hex << cache.getFingerprint() << dec
+             << ", mesmos parâmetros):" << endl;
+        for (unsigned p: path)
+            cout << " -> " << graph.getOriginalId(p);
+        cout << "\nO custo do circuito é " << cached << "." << endl;
+        printGap(cached);
+        cout << "\nO algoritmo demorou cerca de " << (end - start) / chrono::milliseconds(1)
+             << " milissegundos a executar." << endl;
         return;
     }
+    vector<unsigned> best;
+    bool warm = cache.best(best, cached);
+    pair<double, double> circuit;
+    auto heuristic = [this, &path, &incumbent, annealing, seconds](const vector<unsigned> *warmStart) {
+        return annealing ? graph.tspHeuristic(path, &incumbent, warmStart, 0, seconds)
+                         : graph.tspBestImprovement(path, &incumbent, warmStart);
+    };
+    try {
+        circuit = heuristic(warm ? &best : nullptr);
+    } catch (invalid_argument &) {
+        if (!warm) {
+            cout << "\nA nossa heurística não funciona para o grafo em análise. O grafo não é conexo." << endl;
+            return;
+        }
+        warm = false;
+        path.clear();
+        try {
+            circuit = heuristic(nullptr);
+        } catch (invalid_argument &) {
+            cout << "\nA nossa heurística não funciona para o grafo em análise. O grafo não é conexo." << endl;
+            return;
+        }
+    }
+    auto end = chrono::high_resolution_clock::now();
+    cout
+            << "\nDe acordo com a nossa heurística (Nearest Neighbor e " << optimization
+            << "), o circuito que visita todos os nós do grafo com custo mínimo agregado é " << endl;
+    for (unsigned p: path)
+        cout << " -> " << graph.getOriginalId(p);
+    if (warm)
+        cout << "\nO circuito inicial foi o melhor circuito conhecido na cache, de custo " << circuit.first << "."
+             << endl;
+    else
+        cout << "\nO custo do circuito antes da otimização com " << optimization << " é " << circuit.first << "."
+             << endl;
+    cout << "O custo do circuito depois da otimização com " << optimization << " é " << circuit.second
+         << ". Este custo é " << 100.0 * (circuit.first - circuit.second) / circuit.first
+         << "% melhor do que o anterior." << endl;
+    double cost = circuit.second;
+    postOptimize(path, cost, window);
+    cache.store(params.str(), path, cost);
+    if (window) {
+        cout << "\nO circuito pós-otimizado é " << endl;
+        for (unsigned p: path)
+            cout << " -> " << graph.getOriginalId(p);
+        cout << endl;
+    }
+    printGap(cost);
+    cout << "\nO algoritmo demorou cerca de " << (end - start) / chrono::milliseconds(1) << " milissegundos a executar."
+         << endl;
+    reportMemory("heurística (" + optimization + ")", cost, (long) ((end - start) / chrono::milliseconds(1)));
+}
+
+void Management::portfolioSolver() {
+    checkDataset();
+    cout << "\nTempo limite (segundos): ";
+    int seconds = readInt();
+    seconds = validateInt(seconds, 1, 3600);
+    cout << "Número de threads (0 para usar todas as disponíveis): ";
+    int threads = readInt();
+    threads = validateInt(threads, 0, 256);
     vector<unsigned> path;
+    Portfolio portfolio(graph, threads, chrono::seconds(seconds));
     auto start = chrono::high_resolution_clock::now();
-    pair<double, double> circuit = graph.tspHeuristic(path);
+    MemoryProfiler::Scope scope("resolução");
+    double cost = portfolio.solve(path);
+    scope.stop();
     auto end = chrono::high_resolution_clock::now();
+    if (path.empty()) {
+        cout << "\nO portfólio de algoritmos não encontrou nenhum circuito que visite todos os nós do grafo." << endl;
+        return;
+    }
     cout
-            << "\nDe acordo com a nossa heurística (Nearest Neighbor e Simulated Annealing com 2-opt), o circuito que visita todos os nós do grafo com custo mínimo agregado é "
+            << "\nDe acordo com o portfólio de algoritmos, o circuito que visita todos os nós do grafo com custo mínimo agregado é "
             << endl;
     for (unsigned p: path)
-        cout << " -> " << p;
-    cout << "\nO custo do circuito antes da otimização com Simulated Annealing (2-opt) é " << circuit.first << "."
+        cout << " -> " << graph.getOriginalId(p);
+    cout << "\nO custo do circuito é " << cost << "." << endl;
+    cout << "O circuito foi encontrado por: " << portfolio.getAlgorithm() << "." << endl;
+    if (portfolio.isOptimal())
+        cout << "O algoritmo de backtracking terminou antes do tempo limite, pelo que o circuito é ótimo." << endl;
+    else
+        printGap(cost);
+    cout << "\nO algoritmo demorou cerca de " << (end - start) / chrono::milliseconds(1) << " milissegundos a executar."
          << endl;
-    cout << "O custo do circuito depois da otimização com Simulated Annealing (2-opt) é " << circuit.second
-         << ". Este custo é " << 100.0 * (circuit.first - circuit.second) / circuit.first
-         << "% melhor do que o anterior." << endl;
+    reportMemory("portfólio", cost, (long) ((end - start) / chrono::milliseconds(1)));
+}
+
+void Management::memeticAlgorithm() {
+    checkDataset();
+    cout << "\nNúmero de gerações: ";
+    int generations = readInt();
+    generations = validateInt(generations, 1, 100000);
+    cout << "Número de threads (0 para usar todas as disponíveis): ";
+    int threads = readInt();
+    threads = validateInt(threads, 0, 256);
+    double target = readTarget();
+    vector<unsigned> path;
+    auto start = chrono::high_resolution_clock::now();
+    MemoryProfiler::Scope scope("fecho métrico");
+    MetricClosure closure(graph, threads);
+    scope.stop();
+    if (!closure.isConnected()) {
+        cout << "\nO algoritmo memético não funciona para o grafo em análise. O grafo não é conexo." << endl;
+        return;
+    }
+    MemoryProfiler::Scope optimization("otimização");
+    MemeticSolver solver(closure, 30, threads);
+    double cost = solver.solve(path, generations, target);
+    optimization.stop();
+    path = closure.expand(path);
+    auto end = chrono::high_resolution_clock::now();
+    cout
+            << "\nDe acordo com o algoritmo memético, o circuito que visita todos os nós do grafo com custo mínimo agregado é "
+            << endl;
+    for (unsigned p: path)
+        cout << " -> " << graph.getOriginalId(p);
+    cout << "\nO custo do melhor circuito da população inicial é " << solver.getInitialCost() << "." << endl;
+    cout << "O custo do circuito é " << cost << ". Este custo é "
+         << 100.0 * (solver.getInitialCost() - cost) / solver.getInitialCost() << "% melhor do que o anterior." << endl;
+    const vector<double> &diversity = solver.getDiversity();
+    cout << "A diversidade da população (fração média de arestas não partilhadas) passou de " << diversity.front()
+         << " para " << diversity.back() << " ao longo de " << diversity.size() - 1 << " gerações." << endl;
+    printGap(cost);
     cout << "\nO algoritmo demorou cerca de " << (end - start) / chrono::milliseconds(1) << " milissegundos a executar."
          << endl;
+    reportMemory("algoritmo memético", cost, (long) ((end - start) / chrono::milliseconds(1)));
+}
+
+void Management::antColonyOptimization() {
+    checkDataset();
+    cout << "\nNúmero de iterações: ";
+    int iterations = readInt();
+    iterations = validateInt(iterations, 1, 100000);
+    cout << "Número de threads (0 para usar todas as disponíveis): ";
+    int threads = readInt();
+    threads = validateInt(threads, 0, 256);
+    double target = readTarget();
+    vector<unsigned> path;
+    auto start = chrono::high_resolution_clock::now();
+    MemoryProfiler::Scope scope("fecho métrico");
+    MetricClosure closure(graph, threads);
+    scope.stop();
+    if (!closure.isConnected()) {
+        cout << "\nA otimização por colónia de formigas não funciona para o grafo em análise. O grafo não é conexo."
+             << endl;
+        return;
+    }
+    MemoryProfiler::Scope optimization("otimização");
+    AntColony colony(closure, 25, threads);
+    double cost = colony.solve(path, iterations, target);
+    optimization.stop();
+    path = closure.expand(path);
+    auto end = chrono::high_resolution_clock::now();
+    cout
+            << "\nDe acordo com a otimização por colónia de formigas (MAX-MIN Ant System com 2-opt), o circuito que visita todos os nós do grafo com custo mínimo agregado é "
+            << endl;
+    for (unsigned p: path)
+        cout << " -> " << graph.getOriginalId(p);
+    cout << "\nO custo do circuito é " << cost << "." << endl;
+    cout << "Foram construídas " << colony.getAntsConstructed() << " formigas, a cerca de "
+         << (unsigned long long) colony.getAntsPerSecond() << " formigas por segundo." << endl;
+    printGap(cost);
+    cout << "\nO algoritmo demorou cerca de " << (end - start) / chrono::milliseconds(1) << " milissegundos a executar."
+         << endl;
+    reportMemory("colónia de formigas", cost, (long) ((end - start) / chrono::milliseconds(1)));
+}
+
+void Management::decompositionHeuristic() {
+    checkDataset();
+    cout << "\nNúmero médio de nós por grupo: ";
+    int clusterSize = readInt();
+    clusterSize = validateInt(clusterSize, 4, 100000);
+    cout << "Número de threads (0 para usar todas as disponíveis): ";
+    int threads = readInt();
+    threads = validateInt(threads, 0, 256);
+    vector<unsigned> path;
+    Decomposition decomposition(graph, clusterSize, threads);
+    auto start = chrono::high_resolution_clock::now();
+    double cost;
+    try {
+        MemoryProfiler::Scope scope("resolução");
+        cost = decomposition.solve(path);
+    } catch (invalid_argument &) {
+        cout << "\nA decomposição geográfica não funciona para o grafo em análise. Os nós não têm coordenadas ou o grafo não é conexo."
+             << endl;
+        return;
+    }
+    auto end = chrono::high_resolution_clock::now();
+    cout
+            << "\nDe acordo com a decomposição geográfica, o circuito que visita todos os nós do grafo com custo mínimo agregado é "
+            << endl;
+    for (unsigned p: path)
+        cout << " -> " << graph.getOriginalId(p);
+    cout << "\nOs nós foram divididos em " << decomposition.getClusters() << " grupos." << endl;
+    cout << "O custo do circuito antes da reparação das fronteiras é "
+         << decomposition.getStitchedCost() << "." << endl;
+    cout << "O custo do circuito é " << cost << "." << endl;
+    cout << "\nO algoritmo demorou cerca de " << (end - start) / chrono::milliseconds(1) << " milissegundos a executar."
+         << endl;
+    reportMemory("decomposição geográfica", cost, (long) ((end - start) / chrono::milliseconds(1)));
+}
+
+void Management::constructionHeuristic() {
+    checkDataset();
+    cout << "\nConstrução:\n"
+            "1 - Greedy Edge\n"
+            "2 - Christofides\n"
+            "Opção: ";
+    int option = readInt();
+    option = validateInt(option, 1, 2);
+    double target = readTarget();
+    string algorithm = option == 1 ? "Greedy Edge" : "Christofides";
+    auto start = chrono::high_resolution_clock::now();
+    MemoryProfiler::Scope scope("fecho métrico");
+    MetricClosure closure(graph);
+    scope.stop();
+    if (!closure.isConnected()) {
+        cout << "\nA construção " << algorithm << " não funciona para o grafo em análise. O grafo não é conexo." << endl;
+        return;
+    }
+    auto built = chrono::high_resolution_clock::now();
+    MemoryProfiler::Scope construction("construção");
+    vector<unsigned> tour = option == 1 ? TourConstruction::greedyEdge(closure) : graph.tspChristofides(closure);
+    construction.stop();
+    auto constructed = chrono::high_resolution_clock::now();
+    double before = TourConstruction::tourCost(closure, tour);
+    MemoryProfiler::Scope optimization("otimização");
+    double after = LocalSearch(closure).twoOpt(tour, target);
+    optimization.stop();
+    auto end = chrono::high_resolution_clock::now();
+    vector<unsigned> path = closure.expand(TourConstruction::toCircuit(tour));
+    cout << "\nDe acordo com a construção " << algorithm
+         << " otimizada com 2-opt, o circuito que visita todos os nós do grafo com custo mínimo agregado é " << endl;
+    for (unsigned p: path)
+        cout << " -> " << graph.getOriginalId(p);
+    cout << "\nO custo do circuito construído com " << algorithm << " é " << before << "." << endl;
+    cout << "O custo do circuito depois da otimização com 2-opt é " << after << ". Este custo é "
+         << (before - after) / before * 100 << "% melhor do que o anterior." << endl;
+    printGap(after);
+    cout << "\nO fecho métrico demorou cerca de " << (built - start) / chrono::milliseconds(1)
+         << " milissegundos a calcular." << endl;
+    cout << "A construção demorou cerca de " << (constructed - built) / chrono::milliseconds(1)
+         << " milissegundos a executar." << endl;
+    cout << "A otimização com 2-opt demorou cerca de " << (end - constructed) / chrono::milliseconds(1)
+         << " milissegundos a executar." << endl;
+    reportMemory(algorithm + " e 2-opt", after, (long) ((end - start) / chrono::milliseconds(1)));
+}
+
+void Management::tourMergingHeuristic() {
+    checkDataset();
+    cout << "\nNúmero de execuções: ";
+    int runs = readInt();
+    runs = validateInt(runs, 2, 64);
+    cout << "Número de threads (0 para usar todas as disponíveis): ";
+    int threads = readInt();
+    threads = validateInt(threads, 0, 256);
+    auto start = chrono::high_resolution_clock::now();
+    MemoryProfiler::Scope scope("fecho métrico");
+    MetricClosure closure(graph, threads);
+    scope.stop();
+    if (!closure.isConnected()) {
+        cout << "\nA fusão de circuitos não funciona para o grafo em análise. O grafo não é conexo." << endl;
+        return;
+    }
+    vector<vector<unsigned>> circuits(runs);
+    ThreadPool pool(threads);
+    for (int r = 0; r < runs; r++)
+        pool.submit([this, r, &closure, &circuits] { graph.tspHeuristic(closure, circuits[r]); });
+    pool.wait();
+    auto solved = chrono::high_resolution_clock::now();
+    MemoryProfiler::Scope fusion("fusão");
+    TourMerging merging(closure);
+    for (const auto &circuit: circuits)
+        merging.add(circuit);
+    vector<unsigned> path;
+    double cost = merging.merge(path);
+    fusion.stop();
+    path = closure.expand(path);
+    auto end = chrono::high_resolution_clock::now();
+    cout
+            << "\nDe acordo com a fusão dos circuitos da nossa heurística, o circuito que visita todos os nós do grafo com custo mínimo agregado é "
+            << endl;
+    for (unsigned p: path)
+        cout << " -> " << graph.getOriginalId(p);
+    cout << "\nO custo do melhor circuito das " << runs << " execuções é " << merging.getBestInputCost() << "." << endl;
+    cout << "O custo do circuito depois da fusão é " << cost << ". Este custo é "
+         << 100.0 * (merging.getBestInputCost() - cost) / merging.getBestInputCost() << "% melhor do que o anterior."
+         << endl;
+    cout << "O grafo união tem " << merging.getUnionEdges() << " arestas e a largura máxima da fronteira foi "
+         << merging.getWidth() << (merging.isExact() ? " (fusão exata)." : " (fusão aproximada).") << endl;
+    printGap(cost);
+    cout << "\nAs execuções demoraram cerca de " << (solved - start) / chrono::milliseconds(1)
+         << " milissegundos e a fusão cerca de " << (end - solved) / chrono::milliseconds(1) << " milissegundos."
+         << endl;
+    reportMemory("fusão de circuitos", cost, (long) ((end - start) / chrono::milliseconds(1)));
+}
+
+void Management::dynamicTourUpdates() {
+    checkDataset();
+    if (!dynamicTour) {
+        vector<unsigned> path;
+        try {
+            graph.tspTriangularApproximation(path, false);
+            dynamicTour.reset(new DynamicTour(graph, path));
+        } catch (invalid_argument &) {
+            cout << "\nNão é possível construir o circuito inicial para o grafo em análise. O grafo não é conexo." << endl;
+            return;
+        }
+        cout << "\nFoi construído um circuito inicial com a heurística de aproximação triangular, com custo "
+             << dynamicTour->getCost() << "." << endl;
+    }
+    while (true) {
+        cout << "\nO circuito tem " << dynamicTour->size() << " nós e custo " << dynamicTour->getCost() << ".\n"
+                "1 - Inserir nó\n"
+                "2 - Remover nó\n"
+                "3 - Mostrar o circuito\n"
+                "0 - Voltar\n"
+                "Opção: ";
+        int option = readInt();
+        option = validateInt(option, 0, 3);
+        if (option == 0)
+            return;
+        if (option == 3) {
+            for (unsigned p: dynamicTour->getCircuit())
+                cout << " -> " << graph.getOriginalId(p);
+            cout << endl;
+            continue;
+        }
+        cout << "Nó: ";
+        int id = readInt();
+        id = validateInt(id, 0, (int) graph.size() - 1);
+        auto start = chrono::high_resolution_clock::now();
+        try {
+            if (option == 1)
+                dynamicTour->insert(graph.getInternalId(id));
+            else
+                dynamicTour->remove(graph.getInternalId(id));
+        } catch (invalid_argument &) {
+            cout << (option == 1 ? "O nó já pertence ao circuito." : "O nó não pertence ao circuito.") << endl;
+            continue;
+        }
+        auto end = chrono::high_resolution_clock::now();
+        cout << "A atualização demorou cerca de " << (end - start) / chrono::microseconds(1) << " microssegundos."
+             << endl;
+    }
+}
+
+void Management::subsetHeuristic() {
+    checkDataset();
+    vector<unsigned> ids;
+    while (ids.empty()) {
+        cout << "\nNós do subconjunto (separados por espaços): ";
+        istringstream iss(readInput());
+        string field;
+        bool valid = true;
+        while (iss >> field && valid) {
+            valid = isInt(field) && field.size() < 10 && stoul(field) < graph.size();
+            if (valid)
+                ids.push_back(graph.getInternalId(stoul(field)));
+        }
+        if (!valid || ids.empty()) {
+            cout << "Deve inserir ids de nós existentes (entre 0 e " << graph.size() - 1 << "). Tente novamente.";
+            ids.clear();
+        }
+    }
+    vector<unsigned> path;
+    auto start = chrono::high_resolution_clock::now();
+    double cost;
+    try {
+        MemoryProfiler::Scope scope("resolução");
+        SubInstance subset(graph, ids);
+        cost = subset.solve(path);
+    } catch (invalid_argument &) {
+        cout << "\nO subconjunto indicado não é válido: tem nós repetidos ou nós que não são alcançáveis entre si." << endl;
+        return;
+    }
+    auto end = chrono::high_resolution_clock::now();
+    cout << "\nDe acordo com Greedy Edge e 2-opt, o circuito que visita todos os " << ids.size()
+         << " nós do subconjunto com custo mínimo agregado é " << endl;
+    for (unsigned p: path)
+        cout << " -> " << graph.getOriginalId(p);
+    cout << "\nO custo do circuito é " << cost << "." << endl;
+    cout << "\nO algoritmo demorou cerca de " << (end - start) / chrono::milliseconds(1) << " milissegundos a executar."
+         << endl;
+    reportMemory("subconjunto", cost, (long) ((end - start) / chrono::milliseconds(1)));
+}
+
+void Management::metricHeuristic() {
+    checkDataset();
+    if (metric == DistanceMetric::HAVERSINE) {
+        metricHeuristic(HaversineDistance(graph), nullptr);
+    } else if (metric == DistanceMetric::EUCLIDEAN) {
+        metricHeuristic(EuclideanDistance(graph), nullptr);
+    } else if (metric == DistanceMetric::CSR) {
+        metricHeuristic(CsrDistance(graph), nullptr);
+    } else {
+        MetricClosure closure(graph);
+        if (!closure.isConnected()) {
+            cout << "\nOs algoritmos especializados não funcionam para o grafo em análise. O grafo não é conexo." << endl;
+            return;
+        }
+        metricHeuristic(MatrixDistance(closure), &closure);
+    }
+}
+
+template<class Distance>
+void Management::metricHeuristic(const Distance &distance, const MetricClosure *closure) {
+    cout << "\nMétrica de distância: " << metricName(metric) << "." << endl;
+    auto start = chrono::high_resolution_clock::now();
+    MemoryProfiler::Scope scope("construção");
+    vector<unsigned> nearest;
+    double nearestCost = MetricSolver::nearestNeighbor(distance, nearest);
+    auto middle = chrono::high_resolution_clock::now();
+    vector<unsigned> tour;
+    double mst = MetricSolver::triangular(distance, tour);
+    double triangularCost = MetricSolver::cost(distance, tour);
+    scope.stop();
+    auto construction = chrono::high_resolution_clock::now();
+    if (nearestCost < triangularCost)
+        tour = nearest;
+    MemoryProfiler::Scope optimization("otimização");
+    double cost = MetricSolver::twoOpt(distance, MetricSolver::nearestNeighbors(distance, 10), tour);
+    optimization.stop();
+    auto end = chrono::high_resolution_clock::now();
+    if (cost == numeric_limits<double>::infinity()) {
+        cout << "\nOs algoritmos especializados não funcionam para o grafo em análise. O grafo não é conexo." << endl;
+        return;
+    }
+    vector<unsigned> path = TourConstruction::toCircuit(tour);
+    if (closure)
+        path = closure->expand(path);
+    cout << "\nDe acordo com os algoritmos especializados, o circuito que visita todos os nós do grafo com custo mínimo agregado é "
+         << endl;
+    for (unsigned p: path)
+        cout << " -> " << graph.getOriginalId(p);
+    cout << "\nNearest Neighbor: custo " << nearestCost << ", em cerca de " << (middle - start) / chrono::milliseconds(1)
+         << " milissegundos." << endl;
+    cout << "Aproximação triangular: custo " << triangularCost << " (MST: " << mst << "), em cerca de "
+         << (construction - middle) / chrono::milliseconds(1) << " milissegundos." << endl;
+    cout << "2-opt sobre o melhor dos dois: custo " << cost << ", em cerca de "
+         << (end - construction) / chrono::milliseconds(1) << " milissegundos." << endl;
+    if (metric != DistanceMetric::HAVERSINE && metric != DistanceMetric::EUCLIDEAN)
+        printGap(cost);
+    else
+        cout << "O custo usa a distância entre as coordenadas dos nós, mesmo entre nós sem aresta no grafo." << endl;
+    cout << "\nO algoritmo demorou cerca de " << (end - start) / chrono::milliseconds(1) << " milissegundos a executar."
+         << endl;
+    reportMemory("algoritmos especializados (" + metricName(metric) + ")", cost,
+                 (long) ((end - start) / chrono::milliseconds(1)));
+}
+
+void Management::tsplibHeuristic() {
+    cout << "Caminho do ficheiro TSPLIB, relativo ao diretório files (por exemplo, tsplib/berlin52.tsp): ";
+    string file = readInput();
+    auto start = chrono::high_resolution_clock::now();
+    unique_ptr<TsplibInstance> instance;
+    try {
+        instance.reset(new TsplibInstance(file));
+    } catch (invalid_argument &e) {
+        cout << e.what() << endl;
+        return;
+    }
+    auto loaded = chrono::high_resolution_clock::now();
+    unsigned n = instance->size();
+    cout << "Instância " << instance->getName() << " (" << instance->getWeightName() << ", " << n << " nós)";
+    if (!instance->getComment().empty())
+        cout << ": " << instance->getComment();
+    cout << "." << endl;
+    if (n < 2) {
+        cout << "\nA instância tem menos de dois nós." << endl;
+        return;
+    }
+
+    cout << fixed << setprecision(0);
+    bool hilbert;
+    vector<unsigned> tour = instance->construct(hilbert);
+    double constructionCost = MetricSolver::cost(*instance, tour);
+    auto constructed = chrono::high_resolution_clock::now();
+    vector<unsigned> neighbors = instance->nearestNeighbors(TSPLIB_NEIGHBORS);
+    auto listed = chrono::high_resolution_clock::now();
+    double cost = MetricSolver::twoOpt(*instance, neighbors, tour);
+    auto end = chrono::high_resolution_clock::now();
+
+    if (n <= TSPLIB_MAX_PRINTED) {
+        cout << "\nDe acordo com a nossa heurística, o circuito que visita todos os nós da instância com custo mínimo agregado é "
+             << endl;
+        for (unsigned p: TourConstruction::toCircuit(tour))
+            cout << " -> " << p + 1;
+        cout << endl;
+    }
+    auto milliseconds = [](chrono::high_resolution_clock::duration duration) {
+        return duration / chrono::milliseconds(1);
+    };
+    cout << "\nLeitura: cerca de " << milliseconds(loaded - start) << " milissegundos." << endl;
+    cout << (hilbert ? "Curva de Hilbert" : "Nearest Neighbor") << ": custo " << constructionCost << ", em cerca de "
+         << milliseconds(constructed - loaded) << " milissegundos." << endl;
+    cout << "Listas de " << TSPLIB_NEIGHBORS << " vizinhos mais próximos: cerca de " << milliseconds(listed - constructed)
+         << " milissegundos." << endl;
+    cout << "2-opt: custo " << cost << ", em cerca de " << milliseconds(end - listed) << " milissegundos." << endl;
+    double seconds = (end - loaded) / chrono::duration<double>(1.0);
+    cout << "\nO custo do circuito é " << cost << "." << endl;
+    cout << "\nO algoritmo demorou cerca de " << milliseconds(end - start) << " milissegundos a executar (cerca de "
+         << (long) (n / max(seconds, 1e-3)) << " nós por segundo, sem contar com a leitura; pico de RSS de "
+         << setprecision(1) << MemoryProfiler::getPeakRss() / 1024.0 << " MiB)." << endl;
+
+    size_t extension = file.rfind(".tsp");
+    vector<unsigned> optimal;
+    if (extension != string::npos && instance->readTour(file.substr(0, extension) + ".opt.tour", optimal)) {
+        double optimum = MetricSolver::cost(*instance, optimal);
+        cout << "O custo do circuito ótimo (" << file.substr(0, extension) << ".opt.tour) é " << setprecision(0)
+             << optimum << ": o circuito obtido está a " << setprecision(2) << 100.0 * (cost - optimum) / optimum
+             << "% do ótimo." << endl;
+    }
+    cout << defaultfloat << setprecision(6);
+}
+
+void Management::packedHeuristic() {
+    cout << "Caminho do ficheiro CSV com as arestas (origem, destino, distância), relativo ao diretório files (por exemplo, Extra_Fully_Connected_Graphs/edges_900.csv): ";
+    string file = readInput();
+    cout << "A primeira linha do ficheiro é um cabeçalho (1 - Sim, 0 - Não)? ";
+    int header = readInt();
+    header = validateInt(header, 0, 1);
+    cout << "Codificação das distâncias:\n"
+            "1 - double (64 bits, exata)\n"
+            "2 - inteiro de 32 bits (com fator de escala)\n"
+            "3 - quantizada em 16 bits (com fator de escala)\n"
+            "Opção: ";
+    int option = readInt();
+    option = validateInt(option, 1, 3);
+    DistanceStore store(option == 1 ? DistanceEncoding::DOUBLE : option == 2 ? DistanceEncoding::INT32
+                                                                             : DistanceEncoding::QUANTIZED16);
+    auto start = chrono::high_resolution_clock::now();
+    unsigned errors;
+    size_t edges;
+    try {
+        edges = store.read(file, header, errors);
+    } catch (invalid_argument &e) {
+        cout << e.what() << endl;
+        return;
+    }
+    auto loaded = chrono::high_resolution_clock::now();
+    unsigned n = store.size();
+    cout << "Foram lidos " << n << " nós e " << edges << " arestas e ocorreram " << errors << " erros." << endl;
+    cout << "Distâncias (" << store.getEncodingName() << "): " << fixed << setprecision(1)
+         << store.getMemoryUsage() / MEBIBYTE << " MiB, " << setprecision(2)
+         << (edges ? (double) store.getMemoryUsage() / edges : 0.0) << " bytes por aresta";
+    if (store.getEncoding() != DistanceEncoding::DOUBLE)
+        cout << defaultfloat << setprecision(6) << ", fator de escala " << store.getScale()
+             << " (erro máximo de " << store.getMaxError() << " por distância)";
+    cout << defaultfloat << setprecision(6) << "." << endl;
+    if (n < 2 || !store.isComplete()) {
+        cout << "\nO grafo NÃO é completo, pelo que não é possível usar as distâncias compactadas." << endl;
+        return;
+    }
+
+    vector<unsigned> tour;
+    double nearestCost = MetricSolver::nearestNeighbor(store, tour);
+    auto constructed = chrono::high_resolution_clock::now();
+    vector<unsigned> neighbors = MetricSolver::nearestNeighbors(store, PACKED_NEIGHBORS);
+    auto listed = chrono::high_resolution_clock::now();
+    double cost = MetricSolver::twoOpt(store, neighbors, tour);
+    auto end = chrono::high_resolution_clock::now();
+    double exact;
+    try {
+        exact = DistanceStore::exactCost(file, header, tour);
+    } catch (invalid_argument &e) {
+        cout << e.what() << endl;
+        return;
+    }
+
+    if (n <= PACKED_MAX_PRINTED) {
+        cout << "\nDe acordo com a nossa heurística, o circuito que visita todos os nós do grafo com custo mínimo agregado é "
+             << endl;
+        for (unsigned p: TourConstruction::toCircuit(tour))
+            cout << " -> " << p;
+        cout << endl;
+    }
+    auto milliseconds = [](chrono::high_resolution_clock::duration duration) {
+        return duration / chrono::milliseconds(1);
+    };
+    cout << "\nLeitura: cerca de " << milliseconds(loaded - start) << " milissegundos." << endl;
+    cout << "Nearest Neighbor: custo " << nearestCost << ", em cerca de " << milliseconds(constructed - loaded)
+         << " milissegundos." << endl;
+    cout << "Listas de " << PACKED_NEIGHBORS << " vizinhos mais próximos: cerca de "
+         << milliseconds(listed - constructed) << " milissegundos." << endl;
+    cout << "2-opt: custo " << cost << " (segundo as distâncias compactadas), em cerca de "
+         << milliseconds(end - listed) << " milissegundos." << endl;
+    cout << "\nO custo do circuito, recalculado em double a partir das distâncias do ficheiro, é " << exact
+         << " (diferença de " << exact - cost << ")." << endl;
+    cout << "\nO algoritmo demorou cerca de " << milliseconds(end - start) << " milissegundos a executar (pico de RSS de "
+         << fixed << setprecision(1) << MemoryProfiler::getPeakRss() / 1024.0 << " MiB)." << endl;
+    cout << defaultfloat << setprecision(6);
 }
@@ -6,9 +6,16 @@
 #define TSP_MANAGEMENT_H
 
 
+#include <memory>
 #include <string>
 #include <unordered_set>
 #include "Graph.h"
+#include "DynamicTour.h"
+#include "DistancePolicy.h"
+#include "DatasetLoader.h"
+#include "GraphCache.h"
+
+#define GRAPH_CACHE_BUDGET ((std::size_t) 512 << 20)
 
 class Management {
 public:
@@ -20,11 +27,15 @@ public:
     bool menu();
 
 private:
-    std::string nodesFile;
-    std::string edgesFile;
-    std::string graphFile;
     bool filesRead = false;
+    std::string dataset;
     Graph graph;
+    GraphCache graphs{GRAPH_CACHE_BUDGET};
+    double lowerBound = 0.0;
+    std::unique_ptr<DynamicTour> dynamicTour;
+    std::unique_ptr<DatasetLoader> loader;
+    DistanceMetric metric = DistanceMetric::MATRIX;
+    bool geometric = false;
 
     /**@brief Verifica se str é um número inteiro não negativo.
      *
@@ -67,49 +78,49 @@ private:
      */
     static int validateInt(int n, const std::unordered_set<int> &valid);
 
-    /**@brief Lê o ficheiro de nós e cria os nós do grafo.
+    /**@brief Pergunta que ficheiros de dados ler e lê-os (ver loadDataset), depois de esperar pela leitura anterior.
      *
-     * Complexidade Temporal: O(n), sendo n o número de linhas do ficheiro de nós
-     * @return true se a leitura do ficheiro de nós foi bem-sucedida, false caso contrário
+     * Complexidade Temporal: O(1) (a leitura decorre em segundo plano)
      */
-    bool readNodesFile();
+    void readDataset();
 
-    /**@brief Lê o ficheiro de arestas e preenche o grafo com as arestas.
+    /**@brief Torna ativo o grafo definido pelos ficheiros de dados indicados. O grafo ativo, se tiver sido lido com sucesso, é guardado na cache de grafos; se o novo grafo estiver na cache, é obtido imediatamente, caso contrário começa a ser lido em segundo plano (ver DatasetLoader).
      *
-     * Complexidade Temporal: O(n), sendo n o número de linhas do ficheiro de arestas
-     * @return true se a leitura do ficheiro de arestas foi bem-sucedida, false caso contrário
+     * Complexidade Temporal: O(1) (em média) mais a libertação dos grafos removidos da cache (a leitura decorre em segundo plano)
+     * @param nodesFile caminho do ficheiro de nós, relativo ao diretório files (vazio se o ficheiro de arestas define o grafo sozinho)
+     * @param edgesFile caminho do ficheiro de arestas, relativo ao diretório files
+     * @param header true se a primeira linha do ficheiro de arestas é um cabeçalho, false caso contrário
+     * @param hilbert true para reordenar os nós ao longo de uma curva de Hilbert, false caso contrário
      */
-    bool readEdgesFile();
+    void loadDataset(const std::string &nodesFile, const std::string &edgesFile, bool header, bool hilbert);
 
-    /**@brief Lê o ficheiro do grafo e cria o grafo.
+    /**@brief Apresenta as características do grafo ativo (se é completo) e escolhe a métrica de distância para os algoritmos especializados.
      *
-     * Complexidade Temporal: O(n), sendo n o número de linhas do ficheiro do grafo
-     * @param header true se a primeira linha do ficheiro do grafo é um cabeçalho, false caso contrário
-     * @return true se a leitura do ficheiro do grafo foi bem-sucedida, false caso contrário
+     * Complexidade Temporal: O(V), sendo V o número de vértices do grafo
      */
-    bool readGraphFile(bool header);
+    void describeDataset();
 
-    /**@brief Lê os ficheiros de dados, depois de limpar os dados anteriores.
+    /**@brief Espera que termine a leitura dos ficheiros de dados em segundo plano, se existir, mostrando o progresso, e apresenta o resultado da leitura.
      *
-     * Complexidade Temporal: O(n), sendo n o número de linhas do(s) ficheiro(s) de dados
+     * Complexidade Temporal: O(n), sendo n o número de linhas do(s) ficheiro(s) de dados que falta ler
      */
-    void readDataset();
+    void finishLoading();
 
-    /**@brief Lê um Toy Graph.
+    /**@brief Lê um Toy Graph (em segundo plano).
      *
-     * Complexidade Temporal: O(n), sendo n o número de linhas do ficheiro do grafo
+     * Complexidade Temporal: O(1) (a leitura decorre em segundo plano)
      */
     void readToyGraph();
 
-    /**@brief Lê um Medium-Size Graph
+    /**@brief Lê um Medium-Size Graph (em segundo plano).
      *
-     * Complexidade Temporal: O(n), sendo n o número de linhas do ficheiro do grafo
+     * Complexidade Temporal: O(1) (a leitura decorre em segundo plano)
      */
     void readMediumSizeGraph();
 
-    /**@brief Lê um Real-World Graph.
+    /**@brief Lê um Real-World Graph (em segundo plano). Pergunta também se os algoritmos especializados devem usar a distância geográfica entre as coordenadas em vez dos pesos das arestas.
      *
-     * Complexidade Temporal: O(n), sendo n o número de linhas do ficheiro de nós/arestas
+     * Complexidade Temporal: O(1) (a leitura decorre em segundo plano)
      */
     void readRealWorldGraph();
 
@@ -119,6 +130,52 @@ private:
      */
     void checkDataset();
 
+    /**@brief Retorna o limite inferior de Held-Karp para o custo do circuito ótimo do grafo lido, calculando-o (sobre o fecho métrico, com um circuito Greedy Edge otimizado com 2-opt como limite superior) apenas na primeira vez que é pedido.
+     *
+     * Complexidade Temporal: a do fecho métrico mais O(I V<SUP>2</SUP>) na primeira vez, sendo I o número de iterações da otimização por subgradiente e V o número de vértices do grafo, O(1) nas seguintes
+     * @return limite inferior de Held-Karp (0 se o grafo não é conexo)
+     */
+    double heldKarpBound();
+
+    /**@brief Lê o gap de otimalidade aceitável e converte-o no custo alvo a partir do qual a otimização pode parar mais cedo.
+     *
+     * Complexidade Temporal: O(n), sendo n a posição do primeiro input válido introduzido pelo utilizador (mais o cálculo do limite inferior de Held-Karp, se ainda não foi calculado)
+     * @return custo alvo (0 se o utilizador não pretender parar mais cedo)
+     */
+    double readTarget();
+
+    /**@brief Apresenta o gap de otimalidade do circuito de custo cost em relação ao limite inferior de Held-Karp.
+     *
+     * Complexidade Temporal: O(1) (mais o cálculo do limite inferior de Held-Karp, se ainda não foi calculado)
+     * @param cost custo do circuito
+     */
+    void printGap(double cost);
+
+    /**@brief Lê a janela da pós-otimização de Balas-Simonetti.
+     *
+     * Complexidade Temporal: O(n), sendo n a posição do primeiro input válido introduzido pelo utilizador
+     * @return janela (0 se o utilizador não pretender pós-otimizar)
+     */
+    static unsigned readWindow();
+
+    /**@brief Pós-otimiza o circuito path de custo cost com a programação dinâmica de Balas-Simonetti de janela window, apresentando a melhoria obtida e o tempo gasto.
+     *
+     * Complexidade Temporal: a de Graph::tspBalasSimonetti
+     * @param path circuito a otimizar, substituído pelo circuito otimizado
+     * @param cost custo do circuito, atualizado para o custo do circuito otimizado
+     * @param window janela (0 para não pós-otimizar)
+     */
+    void postOptimize(std::vector<unsigned> &path, double &cost, unsigned window);
+
+    /**@brief Apresenta a memória ocupada pelo grafo (bytes por nó e por aresta) e, para cada fase medida desde a última chamada (carregamento, fecho métrico, MST, construção, otimização, ...), o número de alocações, a memória alocada, o pico de RSS e o tempo, e acrescenta-os ao ficheiro de resultados.
+     *
+     * Complexidade Temporal: O(f), sendo f o número de fases medidas
+     * @param algorithm algoritmo executado
+     * @param cost custo do circuito encontrado (0 se não se aplica)
+     * @param milliseconds tempo de execução, em milissegundos
+     */
+    void reportMemory(const std::string &algorithm, double cost, long milliseconds);
+
     /**@brief Resolve o Travelling Salesperson Problem (TSP) através de um algoritmo de backtracking.
      *
      * Complexidade Temporal: O(V!), sendo V o número de vértices do grafo a analisar
@@ -132,10 +189,86 @@ private:
     void triangularApproximationHeuristic();
 
     /**@brief Resolve (de forma aproximada) o Travelling Salesperson Problem (TSP) através de uma combinação de heurísticas: Nearest Neighbor para a construção do circuito e Simulated Annealing com 2-opt para a otimização.
+     * Os resultados ficam guardados numa cache persistente (diretório cache), indexada pela impressão digital do grafo e pelos parâmetros: se os parâmetros coincidirem, o circuito guardado é devolvido imediatamente; caso contrário, o melhor circuito conhecido para o grafo é usado como ponto de partida.
      *
      * Complexidade Temporal: O(V<SUP>2</SUP>), sendo V o número de vértices do grafo a analisar
      */
     void ourHeuristic();
+
+    /**@brief Resolve o Travelling Salesperson Problem (TSP) através de um portfólio de algoritmos executados concorrentemente (backtracking, heurística de aproximação triangular e a nossa heurística), que partilham a melhor solução conhecida até um tempo limite.
+     *
+     * Complexidade Temporal: O(T), sendo T o tempo limite introduzido pelo utilizador
+     */
+    void portfolioSolver();
+
+    /**@brief Resolve (de forma aproximada) o Travelling Salesperson Problem (TSP) através de um algoritmo memético (algoritmo genético com Order Crossover e pesquisa local 2-opt), com os descendentes avaliados em paralelo.
+     *
+     * Complexidade Temporal: O(G P V<SUP>2</SUP> / T), sendo G o número de gerações, P o tamanho da população, V o número de vértices do grafo a analisar e T o número de threads
+     */
+    void memeticAlgorithm();
+
+    /**@brief Resolve (de forma aproximada) o Travelling Salesperson Problem (TSP) através de otimização por colónia de formigas (MAX-MIN Ant System com 2-opt), com as formigas construídas em paralelo.
+     *
+     * Complexidade Temporal: O(I (m V k / T + V<SUP>2</SUP>)), sendo I o número de iterações, m o número de formigas, V o número de vértices do grafo a analisar, k o tamanho das listas de candidatos e T o número de threads
+     */
+    void antColonyOptimization();
+
+    /**@brief Resolve (de forma aproximada) o Travelling Salesperson Problem (TSP) por decomposição geográfica (para grafos muito grandes, com coordenadas): agrupa os vértices, resolve cada grupo em paralelo e junta os circuitos.
+     *
+     * Complexidade Temporal: O(V k I / T + V c), sendo V o número de vértices do grafo a analisar, k o número de grupos, I o número de iterações do k-means, c o tamanho dos grupos e T o número de threads
+     */
+    void decompositionHeuristic();
+
+    /**@brief Resolve (de forma aproximada) o Travelling Salesperson Problem (TSP) através de uma construção (Greedy Edge ou Christofides), à escolha do utilizador, otimizada com 2-opt. Apresenta separadamente o tempo da construção e o da otimização.
+     *
+     * Complexidade Temporal: a do fecho métrico e da construção escolhida, mais O(m n) para o 2-opt, sendo m o número de melhorias e n o número de vértices do grafo
+     */
+    void constructionHeuristic();
+
+    /**@brief Resolve (de forma aproximada) o Travelling Salesperson Problem (TSP) através de várias execuções em paralelo da nossa heurística, cujos circuitos são depois fundidos (resolução exata, ou quase exata, no grafo união das suas arestas).
+     *
+     * Complexidade Temporal: a do fecho métrico, mais O(R V<SUP>2</SUP> / T) para as execuções e O(V S w<SUP>2</SUP>) para a fusão, sendo V o número de vértices do grafo, R o número de execuções, T o número de threads, S o número de estados por passo e w a largura da fronteira
+     */
+    void tourMergingHeuristic();
+
+    /**@brief Permite atualizar um circuito, inserindo ou removendo nós um a um (inserção mais barata ou remoção, seguidas de reparação local com 2-opt e Or-opt), sem resolver novamente o problema. O circuito inicial é o da heurística de aproximação triangular e é mantido entre utilizações, até serem lidos outros dados.
+     *
+     * Complexidade Temporal: a da heurística de aproximação triangular na primeira utilização, mais O(k (log(d) + L)) por atualização, sendo k o número de vizinhos considerados, d o grau dos vértices e L o comprimento máximo dos segmentos invertidos
+     */
+    void dynamicTourUpdates();
+
+    /**@brief Resolve (de forma aproximada) o Travelling Salesperson Problem (TSP) sobre um subconjunto dos nós indicado pelo utilizador, usando as distâncias do grafo lido (sem construir um novo grafo).
+     *
+     * Complexidade Temporal: O(m (m + E log(V)) + m<SUP>2</SUP> log(m)), sendo m o tamanho do subconjunto, V o número de vértices e E o número de arestas do grafo (mais o 2-opt)
+     */
+    void subsetHeuristic();
+
+    /**@brief Resolve (de forma aproximada) o Travelling Salesperson Problem (TSP) com Nearest Neighbor, aproximação triangular (Prim para grafos densos) e 2-opt especializados em tempo de compilação para a métrica de distância escolhida quando os dados foram lidos.
+     *
+     * Complexidade Temporal: O(V<SUP>2</SUP> log(k)), sendo V o número de vértices do grafo e k o número de vizinhos considerados pelo 2-opt (mais o 2-opt)
+     */
+    void metricHeuristic();
+
+    /**@brief Executa e apresenta os algoritmos de metricHeuristic para a política de distância distance.
+     *
+     * Complexidade Temporal: O(V<SUP>2</SUP> log(k)), sendo V o número de vértices do grafo e k o número de vizinhos considerados pelo 2-opt (mais o 2-opt)
+     * @param distance política de distância
+     * @param closure fecho métrico usado para expandir o circuito (nullptr se as distâncias não forem de caminhos mais curtos)
+     */
+    template<class Distance>
+    void metricHeuristic(const Distance &distance, const MetricClosure *closure);
+
+    /**@brief Resolve (de forma aproximada) o Travelling Salesperson Problem (TSP) para uma instância TSPLIB indicada pelo utilizador, independente do grafo lido: constrói um circuito (Nearest Neighbor ou curva de Hilbert) e otimiza-o com 2-opt sobre listas de vizinhos, calculando as distâncias a pedido a partir das coordenadas. Apresenta os tempos de cada fase e, se existir um ficheiro .opt.tour com o circuito ótimo ao lado da instância, a distância ao ótimo.
+     *
+     * Complexidade Temporal: O(V k log(k)) em média para instâncias grandes com coordenadas, O(V<SUP>2</SUP>) nos restantes casos, sendo V o número de vértices e k o número de vizinhos considerados pelo 2-opt (mais o 2-opt)
+     */
+    void tsplibHeuristic();
+
+    /**@brief Resolve (de forma aproximada) o Travelling Salesperson Problem (TSP) para um grafo completo lido de um ficheiro CSV indicado pelo utilizador, sem o ler para o grafo: as distâncias são guardadas uma única vez num DistanceStore (double, inteiro de 32 bits ou quantizadas em 16 bits), sobre o qual correm Nearest Neighbor e 2-opt. O custo final é recalculado em double a partir das distâncias do ficheiro.
+     *
+     * Complexidade Temporal: O(n + V<SUP>2</SUP> log(k)), sendo n o tamanho do ficheiro, V o número de vértices e k o número de vizinhos considerados pelo 2-opt (mais o 2-opt)
+     */
+    void packedHeuristic();
 };
 
 
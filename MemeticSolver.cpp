@@ -0,0 +1,157 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#include "MemeticSolver.h"
+#include "ThreadPool.h"
+#include "TourConstruction.h"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+using namespace std;
+
+MemeticSolver::MemeticSolver(const MetricClosure &closure, unsigned populationSize, unsigned threads, unsigned seed)
+        : closure(closure), localSearch(closure), populationSize(max(2u, populationSize)), threads(threads),
+          seed(seed) {}
+
+double MemeticSolver::solve(vector<unsigned> &circuit, unsigned generations, double target) {
+    unsigned n = closure.size();
+    diversity.clear();
+    if (n < 4) {
+        vector<unsigned> tour(n);
+        iota(tour.begin(), tour.end(), 0);
+        circuit = TourConstruction::toCircuit(tour);
+        initialCost = TourConstruction::tourCost(closure, tour);
+        return initialCost;
+    }
+
+    ThreadPool pool(threads);
+    vector<vector<unsigned>> population(populationSize);
+    vector<double> costs(populationSize);
+    for (unsigned i = 0; i < populationSize; i++)
+        pool.submit([this, i, n, &population, &costs] {
+            mt19937 rng(seed + i);
+            unsigned start = uniform_int_distribution<unsigned>(0, n - 1)(rng);
+            if (i == 0)
+                population[i] = TourConstruction::greedyEdge(closure);
+            else if (i % 2)
+                population[i] = TourConstruction::nearestNeighbor(closure, start, rng, 3);
+            else
+                population[i] = TourConstruction::mstPreorder(closure, start, &rng);
+            costs[i] = localSearch.twoOpt(population[i]);
+        });
+    pool.wait();
+    unsigned fittest = min_element(costs.begin(), costs.end()) - costs.begin();
+    swap(population[0], population[fittest]);
+    swap(costs[0], costs[fittest]);
+    initialCost = costs[0];
+    diversity.push_back(measureDiversity(population));
+
+    vector<vector<unsigned>> offspring(populationSize);
+    vector<double> offspringCosts(populationSize);
+    for (unsigned generation = 0; generation < generations && costs[0] > target; generation++) {
+        for (unsigned i = 0; i < populationSize; i++)
+            pool.submit([this, i, generation, &population, &costs, &offspring, &offspringCosts] {
+                mt19937 rng(seed ^ (2654435761u * (generation + 1) + i));
+                uniform_int_distribution<unsigned> pick(0, populationSize - 1);
+                auto tournament = [&]() {
+                    unsigned a = pick(rng);
+                    unsigned b = pick(rng);
+                    return costs[a] <= costs[b] ? a : b;
+                };
+                unsigned first = tournament();
+                unsigned second = tournament();
+                offspring[i] = orderCrossover(population[first], population[second], rng);
+                offspringCosts[i] = localSearch.twoOpt(offspring[i]);
+            });
+        pool.wait();
+
+        vector<unsigned> order(2 * populationSize);
+        iota(order.begin(), order.end(), 0);
+        auto costOf = [&](unsigned k) { return k < populationSize ? costs[k] : offspringCosts[k - populationSize]; };
+        stable_sort(order.begin(), order.end(), [&](unsigned a, unsigned b) { return costOf(a) < costOf(b); });
+        vector<vector<unsigned>> survivors;
+        vector<double> survivorCosts;
+        vector<char> used(2 * populationSize, false);
+        double last = -1.0;
+        for (unsigned pass = 0; pass < 2; pass++)
+            for (unsigned k: order) {
+                if (survivors.size() == populationSize)
+                    break;
+                if (used[k] || (pass == 0 && fabs(costOf(k) - last) < 1e-9))
+                    continue;
+                used[k] = true;
+                last = costOf(k);
+                survivors.push_back(k < populationSize ? move(population[k]) : move(offspring[k - populationSize]));
+                survivorCosts.push_back(costOf(k));
+            }
+        vector<unsigned> ranking(populationSize);
+        iota(ranking.begin(), ranking.end(), 0);
+        sort(ranking.begin(), ranking.end(), [&](unsigned a, unsigned b) { return survivorCosts[a] < survivorCosts[b]; });
+        for (unsigned k = 0; k < populationSize; k++) {
+            population[k] = move(survivors[ranking[k]]);
+            costs[k] = survivorCosts[ranking[k]];
+        }
+        diversity.push_back(measureDiversity(population));
+    }
+
+    circuit = TourConstruction::toCircuit(population[0]);
+    return costs[0];
+}
+
+double MemeticSolver::getInitialCost() const {
+    return initialCost;
+}
+
+const vector<double> &MemeticSolver::getDiversity() const {
+    return diversity;
+}
+
+vector<unsigned> MemeticSolver::orderCrossover(const vector<unsigned> &first, const vector<unsigned> &second,
+                                               mt19937 &rng) {
+    unsigned n = first.size();
+    uniform_int_distribution<unsigned> cut(0, n - 1);
+    unsigned begin = cut(rng);
+    unsigned end = cut(rng);
+    if (begin > end)
+        swap(begin, end);
+    vector<unsigned> child(n);
+    vector<char> taken(n, false);
+    for (unsigned i = begin; i <= end; i++) {
+        child[i] = first[i];
+        taken[first[i]] = true;
+    }
+    unsigned position = (end + 1) % n;
+    for (unsigned k = 0; k < n; k++) {
+        unsigned v = second[(end + 1 + k) % n];
+        if (taken[v])
+            continue;
+        child[position] = v;
+        position = (position + 1) % n;
+    }
+    return child;
+}
+
+double MemeticSolver::measureDiversity(const vector<vector<unsigned>> &population) {
+    unsigned size = population.size();
+    if (size < 2)
+        return 0.0;
+    unsigned n = population[0].size();
+    vector<vector<unsigned>> succ(size, vector<unsigned>(n)), pred(size, vector<unsigned>(n));
+    for (unsigned p = 0; p < size; p++)
+        for (unsigned i = 0; i < n; i++) {
+            succ[p][population[p][i]] = population[p][(i + 1) % n];
+            pred[p][population[p][(i + 1) % n]] = population[p][i];
+        }
+    double total = 0.0;
+    for (unsigned a = 0; a < size; a++)
+        for (unsigned b = a + 1; b < size; b++) {
+            unsigned shared = 0;
+            for (unsigned v = 0; v < n; v++)
+                if (succ[a][v] == succ[b][v] || succ[a][v] == pred[b][v])
+                    shared++;
+            total += 1.0 - (double) shared / n;
+        }
+    return total / ((double) size * (size - 1) / 2);
+}
@@ -0,0 +1,81 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#ifndef TSP_MEMETICSOLVER_H
+#define TSP_MEMETICSOLVER_H
+
+
+#include <random>
+#include <vector>
+#include "LocalSearch.h"
+#include "MetricClosure.h"
+
+class MemeticSolver {
+public:
+    /**@brief Construtor com parâmetros. Prepara um algoritmo memético (algoritmo genético com pesquisa local) sobre closure.
+     *
+     * Complexidade Temporal: O(V<SUP>2</SUP> log(k)), sendo V o número de vértices e k o número de vizinhos das listas de candidatos da pesquisa local
+     * @param closure fecho métrico do grafo
+     * @param populationSize número de circuitos da população
+     * @param threads número de threads a usar (se 0, usa o número de threads suportadas pelo hardware)
+     * @param seed semente do gerador de números aleatórios
+     */
+    MemeticSolver(const MetricClosure &closure, unsigned populationSize = 30, unsigned threads = 0,
+                  unsigned seed = std::random_device()());
+
+    /**@brief Resolve (de forma aproximada) o Travelling Salesperson Problem (TSP): gera a população inicial com Nearest Neighbor aleatorizado, pré-ordem de MSTs e Greedy Edge, e em cada geração cria descendentes através de Order Crossover (OX) seguido de 2-opt, avaliados em paralelo, mantendo os melhores circuitos distintos.
+     *
+     * Complexidade Temporal: O(G P n<SUP>2</SUP> / T), sendo G o número de gerações, P o tamanho da população, n o número de vértices e T o número de threads (no pior caso)
+     * @param circuit melhor circuito encontrado (começa e acaba no vértice de id 0)
+     * @param generations número de gerações
+     * @param target custo alvo: pára no fim da primeira geração em que o melhor circuito tenha custo menor ou igual (opcional)
+     * @return custo do melhor circuito encontrado
+     */
+    double solve(std::vector<unsigned> &circuit, unsigned generations, double target = 0.0);
+
+    /**@brief Retorna o custo do melhor circuito da população inicial (depois do 2-opt).
+     *
+     * Complexidade Temporal: O(1)
+     * @return custo do melhor circuito da população inicial
+     */
+    double getInitialCost() const;
+
+    /**@brief Retorna a diversidade da população no início e no fim de cada geração da última resolução, i. e., a fração média de arestas não partilhadas entre dois circuitos da população (0 se todos os circuitos forem iguais).
+     *
+     * Complexidade Temporal: O(1)
+     * @return diversidade da população ao longo das gerações (o primeiro valor corresponde à população inicial)
+     */
+    const std::vector<double> &getDiversity() const;
+
+private:
+    const MetricClosure &closure;
+    LocalSearch localSearch;
+    unsigned populationSize;
+    unsigned threads;
+    unsigned seed;
+    double initialCost = 0.0;
+    std::vector<double> diversity;
+
+    /**@brief Cruza os circuitos first e second através de Order Crossover (OX): copia um segmento aleatório de first e completa com os restantes vértices pela ordem em que aparecem em second.
+     *
+     * Complexidade Temporal: O(n), sendo n o número de vértices
+     * @param first primeiro progenitor
+     * @param second segundo progenitor
+     * @param rng gerador de números aleatórios
+     * @return circuito descendente
+     */
+    static std::vector<unsigned>
+    orderCrossover(const std::vector<unsigned> &first, const std::vector<unsigned> &second, std::mt19937 &rng);
+
+    /**@brief Calcula a diversidade da população population, i. e., a fração média de arestas não partilhadas entre cada par de circuitos.
+     *
+     * Complexidade Temporal: O(P<SUP>2</SUP> n), sendo P o tamanho da população e n o número de vértices
+     * @param population população de circuitos
+     * @return diversidade da população
+     */
+    static double measureDiversity(const std::vector<std::vector<unsigned>> &population);
+};
+
+
+#endif //TSP_MEMETICSOLVER_H
@@ -0,0 +1,217 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#include "MemoryProfiler.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <new>
+
+#if !defined(__linux__) && (defined(__unix__) || defined(__APPLE__))
+#include <sys/resource.h>
+#endif
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+using namespace std;
+
+static atomic<unsigned long long> allocations(0);
+static atomic<unsigned long long> deallocations(0);
+static atomic<unsigned long long> allocatedBytes(0);
+
+static void *allocate(size_t size) {
+    void *pointer = malloc(size ? size : 1);
+    if (pointer) {
+        allocations.fetch_add(1, memory_order_relaxed);
+        allocatedBytes.fetch_add(size, memory_order_relaxed);
+    }
+    return pointer;
+}
+
+static void release(void *pointer) {
+    if (pointer) {
+        deallocations.fetch_add(1, memory_order_relaxed);
+        free(pointer);
+    }
+}
+
+void *operator new(size_t size) {
+    void *pointer = allocate(size);
+    if (!pointer)
+        throw bad_alloc();
+    return pointer;
+}
+
+void *operator new[](size_t size) {
+    void *pointer = allocate(size);
+    if (!pointer)
+        throw bad_alloc();
+    return pointer;
+}
+
+void *operator new(size_t size, const nothrow_t &) noexcept {
+    return allocate(size);
+}
+
+void *operator new[](size_t size, const nothrow_t &) noexcept {
+    return allocate(size);
+}
+
+void operator delete(void *pointer) noexcept {
+    release(pointer);
+}
+
+void operator delete[](void *pointer) noexcept {
+    release(pointer);
+}
+
+void operator delete(void *pointer, size_t) noexcept {
+    release(pointer);
+}
+
+void operator delete[](void *pointer, size_t) noexcept {
+    release(pointer);
+}
+
+void operator delete(void *pointer, const nothrow_t &) noexcept {
+    release(pointer);
+}
+
+void operator delete[](void *pointer, const nothrow_t &) noexcept {
+    release(pointer);
+}
+
+mutex MemoryProfiler::mutex;
+vector<MemoryProfiler::Phase> MemoryProfiler::phases;
+vector<MemoryProfiler::Phase *> MemoryProfiler::open;
+vector<size_t> MemoryProfiler::pending;
+
+static long long now() {
+    return chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+MemoryProfiler::Scope::Scope(string name) : phase{move(name), allocations.load(), deallocations.load(),
+                                                  allocatedBytes.load(), 0, 0}, start(now()) {
+    lock_guard<std::mutex> lock(MemoryProfiler::mutex);
+    if (open.empty())
+        resetPeakRss();
+    open.push_back(&phase);
+}
+
+MemoryProfiler::Scope::~Scope() {
+    stop();
+}
+
+void MemoryProfiler::Scope::stop() {
+    if (stopped)
+        return;
+    stopped = true;
+    phase.allocations = allocations.load() - phase.allocations;
+    phase.deallocations = deallocations.load() - phase.deallocations;
+    phase.bytes = allocatedBytes.load() - phase.bytes;
+    phase.milliseconds = (long) (now() - start);
+    lock_guard<std::mutex> lock(MemoryProfiler::mutex);
+    open.erase(find(open.begin(), open.end(), &phase));
+    pending.push_back(phases.size());
+    phases.push_back(phase);
+    if (open.empty())
+        fillPeakRss();
+}
+
+unsigned long long MemoryProfiler::getAllocations() {
+    return allocations.load();
+}
+
+unsigned long long MemoryProfiler::getDeallocations() {
+    return deallocations.load();
+}
+
+unsigned long long MemoryProfiler::getAllocatedBytes() {
+    return allocatedBytes.load();
+}
+
+#ifdef __linux__
+
+static size_t readStatus(const string &field) {
+    ifstream status("/proc/self/status");
+    string key;
+    size_t value;
+    while (status >> key) {
+        if (key == field && status >> value)
+            return value;
+        status.ignore(256, '\n');
+    }
+    return 0;
+}
+
+size_t MemoryProfiler::getPeakRss() {
+    return readStatus("VmHWM:");
+}
+
+size_t MemoryProfiler::getCurrentRss() {
+    return readStatus("VmRSS:");
+}
+
+void MemoryProfiler::resetPeakRss() {
+    ofstream("/proc/self/clear_refs") << "5";
+}
+
+#elif defined(__unix__) || defined(__APPLE__)
+
+size_t MemoryProfiler::getPeakRss() {
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+    return usage.ru_maxrss / 1024;
+#else
+    return usage.ru_maxrss;
+#endif
+}
+
+size_t MemoryProfiler::getCurrentRss() {
+    return 0;
+}
+
+void MemoryProfiler::resetPeakRss() {}
+
+#else
+
+size_t MemoryProfiler::getPeakRss() {
+    return 0;
+}
+
+size_t MemoryProfiler::getCurrentRss() {
+    return 0;
+}
+
+void MemoryProfiler::resetPeakRss() {}
+
+#endif
+
+void MemoryProfiler::fillPeakRss() {
+    if (pending.empty())
+        return;
+    size_t peak = getPeakRss();
+    for (size_t index: pending)
+        phases[index].peakRss = peak;
+    pending.clear();
+}
+
+vector<MemoryProfiler::Phase> MemoryProfiler::takePhases() {
+    lock_guard<std::mutex> lock(mutex);
+    fillPeakRss();
+    vector<Phase> result;
+    result.swap(phases);
+    return result;
+}
+
+void MemoryProfiler::releaseFreeMemory() {
+#ifdef __GLIBC__
+    malloc_trim(0);
+#endif
+}
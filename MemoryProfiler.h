@@ -0,0 +1,128 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#ifndef TSP_MEMORYPROFILER_H
+#define TSP_MEMORYPROFILER_H
+
+
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <vector>
+
+class MemoryProfiler {
+public:
+    /**@brief Consumo de memória de uma fase de um algoritmo (carregamento, MST, construção, otimização, ...).
+     */
+    struct Phase {
+        std::string name;
+        unsigned long long allocations;
+        unsigned long long deallocations;
+        unsigned long long bytes;
+        std::size_t peakRss;
+        long milliseconds;
+    };
+
+    /**@brief Fase medida enquanto o objeto existe: no fim, regista as alocações feitas (por todas as threads), a memória alocada e o pico do Resident Set Size (RSS) do processo durante a fase.
+     */
+    class Scope {
+    public:
+        /**@brief Construtor com parâmetros. Começa a medir a fase name. Se não houver outras fases abertas, recomeça a contagem do pico de RSS; caso contrário, a fase fica com o pico medido desde que abriu a fase mais exterior.
+         *
+         * Complexidade Temporal: O(f), sendo f o número de fases abertas
+         * @param name nome da fase
+         */
+        explicit Scope(std::string name);
+
+        /**@brief Destrutor. Termina a fase e regista-a.
+         *
+         * Complexidade Temporal: O(f), sendo f o número de fases abertas
+         */
+        ~Scope();
+
+        /**@brief Termina a fase antes do fim do bloco e regista-a (sem efeito se a fase já terminou).
+         *
+         * Complexidade Temporal: O(f), sendo f o número de fases abertas
+         */
+        void stop();
+
+        Scope(const Scope &) = delete;
+
+        Scope &operator=(const Scope &) = delete;
+
+    private:
+        Phase phase;
+        long long start;
+        bool stopped = false;
+    };
+
+    /**@brief Retorna o número de alocações feitas com new desde o início do programa.
+     *
+     * Complexidade Temporal: O(1)
+     * @return número de alocações
+     */
+    static unsigned long long getAllocations();
+
+    /**@brief Retorna o número de libertações feitas com delete desde o início do programa.
+     *
+     * Complexidade Temporal: O(1)
+     * @return número de libertações
+     */
+    static unsigned long long getDeallocations();
+
+    /**@brief Retorna o total de bytes pedidos em alocações com new desde o início do programa.
+     *
+     * Complexidade Temporal: O(1)
+     * @return bytes alocados
+     */
+    static unsigned long long getAllocatedBytes();
+
+    /**@brief Retorna o pico do Resident Set Size (RSS) do processo desde o último recomeço da contagem (desde o início do programa, se o sistema não permitir recomeçar).
+     *
+     * Complexidade Temporal: O(1)
+     * @return pico de RSS, em KiB (0 se o sistema não o disponibilizar)
+     */
+    static std::size_t getPeakRss();
+
+    /**@brief Retorna o Resident Set Size (RSS) atual do processo.
+     *
+     * Complexidade Temporal: O(1)
+     * @return RSS, em KiB (0 se o sistema não o disponibilizar)
+     */
+    static std::size_t getCurrentRss();
+
+    /**@brief Retira e retorna as fases registadas desde a última chamada, pela ordem em que terminaram.
+     *
+     * Complexidade Temporal: O(f), sendo f o número de fases registadas
+     * @return fases registadas
+     */
+    static std::vector<Phase> takePhases();
+
+    /**@brief Devolve ao sistema a memória livre guardada pelo alocador (em glibc, com malloc_trim), para que o RSS das fases seguintes não dependa do que foi libertado antes.
+     *
+     * Complexidade Temporal: O(h), sendo h o tamanho da heap
+     */
+    static void releaseFreeMemory();
+
+private:
+    static std::mutex mutex;
+    static std::vector<Phase> phases;
+    static std::vector<Phase *> open;
+    static std::vector<std::size_t> pending;
+
+    /**@brief Recomeça a contagem do pico de RSS do processo (em Linux, através de /proc/self/clear_refs). Só é chamada quando abre a fase mais exterior (nenhuma outra fase aberta), para não apagar o pico de fases abertas noutras threads.
+     *
+     * Complexidade Temporal: O(1)
+     */
+    static void resetPeakRss();
+
+    /**@brief Regista o pico de RSS atual (desde a última reposição) em todas as fases terminadas que ainda não o têm: as fases aninhadas ou concorrentes partilham o pico da fase mais exterior, lido uma única vez quando esta termina.
+     *
+     * Complexidade Temporal: O(p), sendo p o número de fases sem pico registado
+     */
+    static void fillPeakRss();
+};
+
+
+#endif //TSP_MEMORYPROFILER_H
@@ -0,0 +1,198 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#include "MetricClosure.h"
+#include "Graph.h"
+#include "ThreadPool.h"
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <queue>
+
+using namespace std;
+
+#define BLOCK_SIZE 64u
+
+MetricClosure::MetricClosure(const Graph &graph, unsigned threads) : n(graph.size()) {
+    const double infinity = numeric_limits<double>::infinity();
+    distances.assign((size_t) n * n, infinity);
+    for (unsigned i = 0; i < n; i++)
+        distances[(size_t) i * n + i] = 0.0;
+
+    if (graph.isComplete()) {
+        for (unsigned i = 0; i < n; i++)
+            for (const Edge *edge: graph.findVertex(i)->getAdj()) {
+                double &distance = distances[(size_t) i * n + edge->getDest()->getId()];
+                distance = min(distance, edge->getDistance());
+            }
+        return;
+    }
+
+    double arcs = 0.0;
+    for (unsigned i = 0; i < n; i++)
+        arcs += graph.findVertex(i)->getAdj().size();
+    double floydWarshallWork = (double) n * n * n;
+    double dijkstraWork = 4.0 * n * (arcs + n) * log2(max(2u, n));
+    if (floydWarshallWork <= dijkstraWork) {
+        next.assign((size_t) n * n, 0);
+        for (unsigned i = 0; i < n; i++) {
+            next[(size_t) i * n + i] = i;
+            for (const Edge *edge: graph.findVertex(i)->getAdj()) {
+                unsigned j = edge->getDest()->getId();
+                if (edge->getDistance() < distances[(size_t) i * n + j]) {
+                    distances[(size_t) i * n + j] = edge->getDistance();
+                    next[(size_t) i * n + j] = j;
+                }
+            }
+        }
+        floydWarshall(threads);
+    } else
+        dijkstra(graph, threads);
+
+    for (double distance: distances)
+        if (distance == infinity) {
+            connected = false;
+            break;
+        }
+}
+
+MetricClosure::MetricClosure(unsigned n, vector<double> distances) : n(n), distances(move(distances)) {
+    for (double distance: this->distances)
+        if (distance == numeric_limits<double>::infinity()) {
+            connected = false;
+            break;
+        }
+}
+
+unsigned MetricClosure::size() const {
+    return n;
+}
+
+bool MetricClosure::isConnected() const {
+    return connected;
+}
+
+double MetricClosure::cost(const vector<unsigned> &circuit) const {
+    double cost = 0.0;
+    for (unsigned i = 0; i + 1 < circuit.size(); i++)
+        cost += getDistance(circuit[i], circuit[i + 1]);
+    return cost;
+}
+
+vector<unsigned> MetricClosure::expand(const vector<unsigned> &circuit) const {
+    if (next.empty() || circuit.empty())
+        return circuit;
+    vector<unsigned> expanded;
+    expanded.push_back(circuit[0]);
+    for (unsigned i = 0; i + 1 < circuit.size(); i++) {
+        unsigned current = circuit[i];
+        unsigned dest = circuit[i + 1];
+        while (current != dest) {
+            current = next[(size_t) current * n + dest];
+            expanded.push_back(current);
+        }
+    }
+    return expanded;
+}
+
+void MetricClosure::floydWarshall(unsigned threads) {
+    unsigned blocks = (n + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    ThreadPool pool(threads);
+    for (unsigned kb = 0; kb < blocks; kb++) {
+        relaxBlock(kb, kb, kb);
+
+        for (unsigned b = 0; b < blocks; b++)
+            if (b != kb)
+                pool.submit([this, b, kb] {
+                    relaxBlock(b, kb, kb);
+                    relaxBlock(kb, b, kb);
+                });
+        pool.wait();
+
+        for (unsigned ib = 0; ib < blocks; ib++)
+            if (ib != kb)
+                pool.submit([this, ib, kb, blocks] {
+                    for (unsigned jb = 0; jb < blocks; jb++)
+                        if (jb != kb)
+                            relaxBlock(ib, jb, kb);
+                });
+        pool.wait();
+    }
+}
+
+void MetricClosure::relaxBlock(unsigned ib, unsigned jb, unsigned kb) {
+    unsigned iEnd = min(n, (ib + 1) * BLOCK_SIZE);
+    unsigned jBegin = jb * BLOCK_SIZE;
+    unsigned jEnd = min(n, (jb + 1) * BLOCK_SIZE);
+    unsigned kEnd = min(n, (kb + 1) * BLOCK_SIZE);
+    for (unsigned k = kb * BLOCK_SIZE; k < kEnd; k++) {
+        const double *rowK = distances.data() + (size_t) k * n;
+        for (unsigned i = ib * BLOCK_SIZE; i < iEnd; i++) {
+            double *rowI = distances.data() + (size_t) i * n;
+            double ik = rowI[k];
+            if (ik == numeric_limits<double>::infinity())
+                continue;
+            unsigned *nextI = next.data() + (size_t) i * n;
+            for (unsigned j = jBegin; j < jEnd; j++)
+                if (ik + rowK[j] < rowI[j]) {
+                    rowI[j] = ik + rowK[j];
+                    nextI[j] = nextI[k];
+                }
+        }
+    }
+}
+
+void MetricClosure::dijkstra(const Graph &graph, unsigned threads) {
+    vector<unsigned> offsets(n + 1, 0);
+    vector<unsigned> targets;
+    vector<double> weights;
+    for (unsigned i = 0; i < n; i++) {
+        for (const Edge *edge: graph.findVertex(i)->getAdj()) {
+            targets.push_back(edge->getDest()->getId());
+            weights.push_back(edge->getDistance());
+        }
+        offsets[i + 1] = targets.size();
+    }
+
+    next.assign((size_t) n * n, 0);
+    ThreadPool pool(threads);
+    unsigned workers = pool.size();
+    for (unsigned t = 0; t < workers; t++)
+        pool.submit([this, t, workers, &offsets, &targets, &weights] {
+            typedef pair<double, unsigned> Entry;
+            vector<unsigned> predecessor(n);
+            vector<unsigned> order;
+            order.reserve(n);
+            for (unsigned source = t; source < n; source += workers) {
+                double *distance = distances.data() + (size_t) source * n;
+                unsigned *first = next.data() + (size_t) source * n;
+                priority_queue<Entry, vector<Entry>, greater<Entry>> queue;
+                order.clear();
+                queue.emplace(0.0, source);
+                predecessor[source] = source;
+                while (!queue.empty()) {
+                    Entry top = queue.top();
+                    queue.pop();
+                    unsigned v = top.second;
+                    if (top.first > distance[v])
+                        continue;
+                    order.push_back(v);
+                    for (unsigned e = offsets[v]; e < offsets[v + 1]; e++) {
+                        unsigned u = targets[e];
+                        double candidate = top.first + weights[e];
+                        if (candidate < distance[u]) {
+                            distance[u] = candidate;
+                            predecessor[u] = v;
+                            queue.emplace(candidate, u);
+                        }
+                    }
+                }
+                first[source] = source;
+                for (unsigned v: order)
+                    if (v != source)
+                        first[v] = predecessor[v] == source ? v : first[predecessor[v]];
+            }
+        });
+    pool.wait();
+}
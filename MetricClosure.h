@@ -0,0 +1,115 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#ifndef TSP_METRICCLOSURE_H
+#define TSP_METRICCLOSURE_H
+
+
+#include <vector>
+
+class Graph;
+
+class MetricClosure {
+public:
+    /**@brief Construtor com parâmetros. Constrói o fecho métrico de graph, i. e., a matriz densa das distâncias dos caminhos mais curtos entre todos os pares de vértices, juntamente com a informação necessária para reconstruir esses caminhos.
+     * Se o grafo for completo, as distâncias são as das próprias arestas. Caso contrário, usa o algoritmo de Floyd-Warshall por blocos em paralelo (grafos médios/densos) ou o algoritmo de Dijkstra a partir de cada vértice em paralelo (grafos grandes e esparsos).
+     *
+     * Complexidade Temporal: O(V<SUP>2</SUP>) se o grafo for completo, O(min(V<SUP>3</SUP>, V (V + E) log(V)) / T) caso contrário, sendo V o número de vértices do grafo, E o número de arestas do grafo e T o número de threads
+     * @param graph grafo cujo fecho métrico se pretende construir
+     * @param threads número de threads a usar (se 0, usa o número de threads suportadas pelo hardware)
+     */
+    explicit MetricClosure(const Graph &graph, unsigned threads = 0);
+
+    /**@brief Construtor com parâmetros. Constrói o fecho métrico diretamente a partir de uma matriz densa de distâncias já calculada (por exemplo, distâncias geográficas entre os vértices de um subconjunto do grafo). Os circuitos não precisam de ser expandidos.
+     *
+     * Complexidade Temporal: O(n<SUP>2</SUP>)
+     * @param n número de vértices
+     * @param distances matriz de distâncias n × n, por linhas
+     */
+    MetricClosure(unsigned n, std::vector<double> distances);
+
+    /**@brief Retorna o número de vértices do fecho métrico.
+     *
+     * Complexidade Temporal: O(1)
+     * @return número de vértices do fecho métrico
+     */
+    unsigned size() const;
+
+    /**@brief Retorna a distância do caminho mais curto entre os vértices de id orig e dest.
+     *
+     * Complexidade Temporal: O(1)
+     * @param orig id do vértice de origem
+     * @param dest id do vértice de destino
+     * @return distância do caminho mais curto entre os vértices (infinito se não existir caminho)
+     */
+    double getDistance(unsigned orig, unsigned dest) const {
+        return distances[(std::size_t) orig * n + dest];
+    }
+
+    /**@brief Retorna a linha da matriz de distâncias correspondente ao vértice de id orig, i. e., as distâncias (contíguas em memória) de orig a todos os vértices.
+     *
+     * Complexidade Temporal: O(1)
+     * @param orig id do vértice de origem
+     * @return apontador para o início da linha da matriz de distâncias
+     */
+    const double *getRow(unsigned orig) const {
+        return distances.data() + (std::size_t) orig * n;
+    }
+
+    /**@brief Indica se todos os pares de vértices estão ligados por um caminho.
+     *
+     * Complexidade Temporal: O(1)
+     * @return true se o grafo é conexo, false caso contrário
+     */
+    bool isConnected() const;
+
+    /**@brief Calcula o custo do circuito circuit, segundo as distâncias do fecho métrico.
+     *
+     * Complexidade Temporal: O(n), sendo n o tamanho do circuito
+     * @param circuit circuito cujo custo se pretende calcular
+     * @return custo do circuito
+     */
+    double cost(const std::vector<unsigned> &circuit) const;
+
+    /**@brief Expande o circuito circuit, definido sobre o fecho métrico, para um circuito que só usa arestas reais do grafo, substituindo cada par de vértices consecutivos pelo caminho mais curto entre eles.
+     *
+     * Complexidade Temporal: O(n + m), sendo n o tamanho do circuito e m o tamanho do circuito expandido
+     * @param circuit circuito a expandir
+     * @return circuito expandido (pode repetir vértices)
+     */
+    std::vector<unsigned> expand(const std::vector<unsigned> &circuit) const;
+
+private:
+    unsigned n;
+    std::vector<double> distances;
+    std::vector<unsigned> next;
+    bool connected = true;
+
+    /**@brief Calcula os caminhos mais curtos entre todos os pares de vértices através do algoritmo de Floyd-Warshall por blocos, processando em paralelo os blocos independentes de cada fase.
+     *
+     * Complexidade Temporal: O(V<SUP>3</SUP> / T), sendo V o número de vértices e T o número de threads
+     * @param threads número de threads a usar
+     */
+    void floydWarshall(unsigned threads);
+
+    /**@brief Relaxa o bloco (ib, jb) da matriz de distâncias através dos vértices intermédios do bloco kb.
+     *
+     * Complexidade Temporal: O(B<SUP>3</SUP>), sendo B o tamanho dos blocos
+     * @param ib índice do bloco de linhas
+     * @param jb índice do bloco de colunas
+     * @param kb índice do bloco de vértices intermédios
+     */
+    void relaxBlock(unsigned ib, unsigned jb, unsigned kb);
+
+    /**@brief Calcula os caminhos mais curtos entre todos os pares de vértices através do algoritmo de Dijkstra a partir de cada vértice, distribuindo as origens pelas threads.
+     *
+     * Complexidade Temporal: O(V (V + E) log(V) / T), sendo V o número de vértices, E o número de arestas e T o número de threads
+     * @param graph grafo cujos caminhos mais curtos se pretende calcular
+     * @param threads número de threads a usar
+     */
+    void dijkstra(const Graph &graph, unsigned threads);
+};
+
+
+#endif //TSP_METRICCLOSURE_H
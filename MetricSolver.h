@@ -0,0 +1,253 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#ifndef TSP_METRICSOLVER_H
+#define TSP_METRICSOLVER_H
+
+
+#include <algorithm>
+#include <deque>
+#include <limits>
+#include <numeric>
+#include <vector>
+#include "LocalSearch.h"
+
+/**@brief Algoritmos parametrizados em tempo de compilação por uma política de distância (MatrixDistance, HaversineDistance, EuclideanDistance ou CsrDistance, ver DistancePolicy.h, TsplibInstance ou DistanceStore): cada política é uma classe com size() e operator()(orig, dest) definidos no cabeçalho, pelo que os ciclos interiores são especializados e a distância é expandida inline para cada métrica.
+ */
+class MetricSolver {
+public:
+    /**@brief Determina, para cada vértice, os seus neighbors vizinhos mais próximos (lista de candidatos), por ordem crescente de distância.
+     *
+     * Complexidade Temporal: O(V<SUP>2</SUP> log(k)), sendo V o número de vértices e k o número de vizinhos
+     * @param distance política de distância
+     * @param neighbors número de vizinhos a considerar para cada vértice (limitado a V - 1)
+     * @return listas de vizinhos mais próximos, contíguas (min(neighbors, V - 1) por vértice)
+     */
+    template<class Distance>
+    static std::vector<unsigned> nearestNeighbors(const Distance &distance, unsigned neighbors);
+
+    /**@brief Constrói um circuito através da heurística Nearest Neighbor, a partir do vértice 0.
+     *
+     * Complexidade Temporal: O(V<SUP>2</SUP>), sendo V o número de vértices
+     * @param distance política de distância
+     * @param tour circuito construído (permutação dos vértices, sem repetir o vértice inicial no fim)
+     * @return custo do circuito construído
+     */
+    template<class Distance>
+    static double nearestNeighbor(const Distance &distance, std::vector<unsigned> &tour);
+
+    /**@brief Determina uma Minimum Cost Spanning Tree (MST) através do algoritmo de Prim para grafos densos, com raiz no vértice 0.
+     *
+     * Complexidade Temporal: O(V<SUP>2</SUP>), sendo V o número de vértices
+     * @param distance política de distância
+     * @param parent pai de cada vértice na árvore (o pai da raiz é a própria raiz)
+     * @return custo da árvore (infinito se o grafo não for conexo)
+     */
+    template<class Distance>
+    static double prim(const Distance &distance, std::vector<unsigned> &parent);
+
+    /**@brief Constrói um circuito através da heurística de aproximação triangular: visita os vértices pela ordem de uma pesquisa em profundidade (pré-ordem) da Minimum Cost Spanning Tree (MST) determinada com prim.
+     *
+     * Complexidade Temporal: O(V<SUP>2</SUP>), sendo V o número de vértices
+     * @param distance política de distância
+     * @param tour circuito construído (permutação dos vértices, sem repetir o vértice inicial no fim)
+     * @return custo da Minimum Cost Spanning Tree (MST), que é um limite inferior para o custo do circuito
+     */
+    template<class Distance>
+    static double triangular(const Distance &distance, std::vector<unsigned> &tour);
+
+    /**@brief Otimiza o circuito tour até um ótimo local 2-opt (restrito às listas de candidatos), usando don't-look bits.
+     *
+     * Complexidade Temporal: O(m n), sendo m o número de melhorias e n o tamanho do circuito (no pior caso)
+     * @param distance política de distância
+     * @param neighbors listas de vizinhos mais próximos (ver nearestNeighbors)
+     * @param tour circuito a otimizar (permutação dos vértices, sem repetir o vértice inicial no fim)
+     * @param target custo alvo: pára assim que o custo do circuito for menor ou igual (opcional)
+     * @return custo do circuito depois da otimização
+     */
+    template<class Distance>
+    static double twoOpt(const Distance &distance, const std::vector<unsigned> &neighbors, std::vector<unsigned> &tour,
+                         double target = 0.0);
+
+    /**@brief Calcula o custo do circuito tour (fechado implicitamente do último para o primeiro vértice).
+     *
+     * Complexidade Temporal: O(n), sendo n o tamanho do circuito
+     * @param distance política de distância
+     * @param tour circuito (permutação dos vértices, sem repetir o vértice inicial no fim)
+     * @return custo do circuito
+     */
+    template<class Distance>
+    static double cost(const Distance &distance, const std::vector<unsigned> &tour);
+};
+
+template<class Distance>
+std::vector<unsigned> MetricSolver::nearestNeighbors(const Distance &distance, unsigned neighbors) {
+    unsigned n = distance.size();
+    unsigned count = n > 1 ? std::min(neighbors, n - 1) : 0;
+    std::vector<unsigned> result((std::size_t) n * count);
+    std::vector<unsigned> others(n);
+    std::vector<double> row(n);
+    for (unsigned v = 0; v < n; v++) {
+        for (unsigned u = 0; u < n; u++)
+            row[u] = distance(v, u);
+        std::iota(others.begin(), others.end(), 0);
+        std::swap(others[v], others.back());
+        std::partial_sort(others.begin(), others.begin() + count, others.end() - 1, [&row](unsigned a, unsigned b) {
+            return row[a] < row[b];
+        });
+        std::copy(others.begin(), others.begin() + count, result.begin() + (std::size_t) v * count);
+    }
+    return result;
+}
+
+template<class Distance>
+double MetricSolver::nearestNeighbor(const Distance &distance, std::vector<unsigned> &tour) {
+    unsigned n = distance.size();
+    tour.clear();
+    if (n == 0)
+        return 0.0;
+    std::vector<char> visited(n, false);
+    double result = 0.0;
+    unsigned vertex = 0;
+    visited[0] = true;
+    tour.push_back(0);
+    for (unsigned i = 1; i < n; i++) {
+        unsigned nearest = n;
+        double best = std::numeric_limits<double>::infinity();
+        for (unsigned j = 0; j < n; j++) {
+            double d = distance(vertex, j);
+            if (!visited[j] && (nearest == n || d < best)) {
+                nearest = j;
+                best = d;
+            }
+        }
+        result += best;
+        vertex = nearest;
+        visited[vertex] = true;
+        tour.push_back(vertex);
+    }
+    return result + distance(vertex, 0);
+}
+
+template<class Distance>
+double MetricSolver::prim(const Distance &distance, std::vector<unsigned> &parent) {
+    unsigned n = distance.size();
+    parent.assign(n, 0);
+    if (n == 0)
+        return 0.0;
+    std::vector<double> key(n, std::numeric_limits<double>::infinity());
+    std::vector<char> inTree(n, false);
+    double result = 0.0;
+    unsigned vertex = 0;
+    inTree[0] = true;
+    for (unsigned i = 1; i < n; i++) {
+        unsigned next = n;
+        for (unsigned j = 0; j < n; j++) {
+            if (inTree[j])
+                continue;
+            double d = distance(vertex, j);
+            if (d < key[j]) {
+                key[j] = d;
+                parent[j] = vertex;
+            }
+            if (next == n || key[j] < key[next])
+                next = j;
+        }
+        result += key[next];
+        vertex = next;
+        inTree[vertex] = true;
+    }
+    return result;
+}
+
+template<class Distance>
+double MetricSolver::triangular(const Distance &distance, std::vector<unsigned> &tour) {
+    unsigned n = distance.size();
+    std::vector<unsigned> parent;
+    double result = prim(distance, parent);
+    std::vector<unsigned> start(n + 1, 0), children(n > 0 ? n - 1 : 0);
+    for (unsigned v = 1; v < n; v++)
+        start[parent[v] + 1]++;
+    std::partial_sum(start.begin(), start.end(), start.begin());
+    std::vector<unsigned> fill(start.begin(), start.end() - 1);
+    for (unsigned v = 1; v < n; v++)
+        children[fill[parent[v]]++] = v;
+    tour.clear();
+    std::vector<unsigned> stack;
+    if (n > 0)
+        stack.push_back(0);
+    while (!stack.empty()) {
+        unsigned v = stack.back();
+        stack.pop_back();
+        tour.push_back(v);
+        for (unsigned c = start[v + 1]; c > start[v]; c--)
+            stack.push_back(children[c - 1]);
+    }
+    return result;
+}
+
+template<class Distance>
+double MetricSolver::twoOpt(const Distance &distance, const std::vector<unsigned> &neighbors, std::vector<unsigned> &tour,
+                            double target) {
+    unsigned n = tour.size();
+    double result = cost(distance, tour);
+    if (n < 4)
+        return result;
+    unsigned count = neighbors.size() / distance.size();
+    std::vector<unsigned> pos(n);
+    for (unsigned i = 0; i < n; i++)
+        pos[tour[i]] = i;
+    auto succ = [&](unsigned v) { return tour[pos[v] + 1 == n ? 0 : pos[v] + 1]; };
+    auto pred = [&](unsigned v) { return tour[pos[v] == 0 ? n - 1 : pos[v] - 1]; };
+
+    std::vector<char> queued(n, true);
+    std::deque<unsigned> queue(tour.begin(), tour.end());
+    while (!queue.empty() && result > target) {
+        unsigned a = queue.front();
+        queue.pop_front();
+        queued[a] = false;
+        bool improved = false;
+        for (int direction = 0; direction < 2 && !improved; direction++) {
+            unsigned b = direction == 0 ? succ(a) : pred(a);
+            double ab = distance(a, b);
+            const unsigned *candidates = neighbors.data() + (std::size_t) a * count;
+            for (unsigned k = 0; k < count; k++) {
+                unsigned c = candidates[k];
+                double gain = ab - distance(a, c);
+                if (gain <= 1e-9)
+                    break;
+                unsigned d = direction == 0 ? succ(c) : pred(c);
+                if (c == b || d == a)
+                    continue;
+                gain += distance(c, d) - distance(b, d);
+                if (gain > 1e-9) {
+                    if (direction == 0)
+                        LocalSearch::reverse(tour, pos, pos[b], pos[c]);
+                    else
+                        LocalSearch::reverse(tour, pos, pos[a], pos[d]);
+                    result -= gain;
+                    for (unsigned v: {a, b, c, d})
+                        if (!queued[v]) {
+                            queued[v] = true;
+                            queue.push_back(v);
+                        }
+                    improved = true;
+                    break;
+                }
+            }
+        }
+    }
+    return result;
+}
+
+template<class Distance>
+double MetricSolver::cost(const Distance &distance, const std::vector<unsigned> &tour) {
+    double result = 0.0;
+    for (unsigned i = 0; i < tour.size(); i++)
+        result += distance(tour[i], tour[i + 1 == tour.size() ? 0 : i + 1]);
+    return result;
+}
+
+
+#endif //TSP_METRICSOLVER_H
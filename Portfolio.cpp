@@ -0,0 +1,63 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#include "Portfolio.h"
+#include "ThreadPool.h"
+#include <atomic>
+#include <stdexcept>
+
+using namespace std;
+
+Portfolio::Portfolio(const Graph &graph, unsigned threads, chrono::milliseconds timeLimit) : graph(graph),
+                                                                                            threads(threads),
+                                                                                            timeLimit(timeLimit) {}
+
+double Portfolio::solve(vector<unsigned> &circuit) {
+    chrono::steady_clock::time_point deadline = chrono::steady_clock::now() + timeLimit;
+    Incumbent incumbent(deadline);
+    atomic<bool> proven(false);
+    {
+        ThreadPool pool(threads);
+
+        pool.submit([this, &incumbent] {
+            vector<unsigned> path;
+            try {
+                double cost = graph.tspTriangularApproximation(path).second;
+                incumbent.offer(cost, path, "Aproximação Triangular");
+            } catch (invalid_argument &) {}
+        });
+
+        pool.submit([this, &incumbent, &proven, deadline] {
+            vector<unsigned> path;
+            graph.tspBacktracking(path, &incumbent);
+            proven = chrono::steady_clock::now() < deadline;
+        });
+
+        MetricClosure closure(graph, threads);
+        if (closure.isConnected()) {
+            unsigned heuristics = pool.size() > 2 ? pool.size() - 2 : 1;
+            for (unsigned i = 0; i < heuristics; i++)
+                pool.submit([this, &incumbent, &closure] {
+                    while (!incumbent.expired()) {
+                        vector<unsigned> path;
+                        graph.tspHeuristic(closure, path, &incumbent);
+                    }
+                });
+        }
+
+        pool.wait();
+    }
+    circuit = incumbent.getCircuit();
+    algorithm = incumbent.getAlgorithm();
+    optimal = proven;
+    return incumbent.getBound();
+}
+
+const string &Portfolio::getAlgorithm() const {
+    return algorithm;
+}
+
+bool Portfolio::isOptimal() const {
+    return optimal;
+}
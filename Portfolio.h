@@ -0,0 +1,56 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#ifndef TSP_PORTFOLIO_H
+#define TSP_PORTFOLIO_H
+
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include "Graph.h"
+
+class Portfolio {
+public:
+    /**@brief Construtor com parâmetros. Constrói um portfólio de algoritmos que resolvem concorrentemente o Travelling Salesperson Problem (TSP) sobre graph.
+     *
+     * Complexidade Temporal: O(1)
+     * @param graph grafo a analisar (partilhado, sem cópia, por todas as execuções)
+     * @param threads número de threads a usar (se 0, usa o número de threads suportadas pelo hardware)
+     * @param timeLimit tempo limite para a resolução
+     */
+    Portfolio(const Graph &graph, unsigned threads, std::chrono::milliseconds timeLimit);
+
+    /**@brief Resolve o Travelling Salesperson Problem (TSP) lançando concorrentemente o algoritmo de backtracking, a heurística de aproximação triangular e várias execuções da nossa heurística (sobre o fecho métrico do grafo, construído uma única vez), que partilham a melhor solução conhecida (usada como limite superior pelo backtracking) até ao tempo limite.
+     *
+     * Complexidade Temporal: O(T), sendo T o tempo limite
+     * @param circuit melhor circuito encontrado
+     * @return custo do melhor circuito encontrado
+     */
+    double solve(std::vector<unsigned> &circuit);
+
+    /**@brief Retorna o nome do algoritmo que encontrou o melhor circuito na última resolução.
+     *
+     * Complexidade Temporal: O(1)
+     * @return nome do algoritmo que encontrou o melhor circuito
+     */
+    const std::string &getAlgorithm() const;
+
+    /**@brief Indica se a última resolução provou que o melhor circuito encontrado é ótimo (o backtracking terminou antes do tempo limite).
+     *
+     * Complexidade Temporal: O(1)
+     * @return true se o melhor circuito encontrado é ótimo, false caso contrário
+     */
+    bool isOptimal() const;
+
+private:
+    const Graph &graph;
+    unsigned threads;
+    std::chrono::milliseconds timeLimit;
+    std::string algorithm;
+    bool optimal = false;
+};
+
+
+#endif //TSP_PORTFOLIO_H
@@ -0,0 +1,49 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#include "ResultsLog.h"
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <sys/stat.h>
+
+#ifdef _WIN32
+#include <direct.h>
+#endif
+
+using namespace std;
+
+ResultsLog::ResultsLog(string directory, const string &file) {
+#ifdef _WIN32
+    _mkdir(directory.c_str());
+#else
+    mkdir(directory.c_str(), 0755);
+#endif
+    path = move(directory) + file;
+}
+
+bool ResultsLog::append(const string &dataset, const string &algorithm, double cost, long milliseconds,
+                        const Graph &graph, const vector<MemoryProfiler::Phase> &phases) const {
+    bool exists = ifstream(path).good();
+    ofstream out(path, ios::app);
+    if (!out)
+        return false;
+    if (!exists)
+        out << "conjunto,algoritmo,custo,milissegundos,nos,arestas,bytes_grafo,bytes_por_no,bytes_por_aresta,"
+               "fase,alocacoes,libertacoes,bytes_alocados,pico_rss_kib,milissegundos_fase\n";
+    ostringstream prefix;
+    prefix << '"' << dataset << "\",\"" << algorithm << "\"," << setprecision(17) << cost << ',' << milliseconds
+           << ',' << graph.size() << ',' << graph.getEdgeCount() << ',' << graph.getMemoryUsage() << ','
+           << graph.getVertexMemoryUsage() << ',' << graph.getEdgeMemoryUsage() << ',';
+    if (phases.empty())
+        out << prefix.str() << ",,,,,\n";
+    for (const auto &phase: phases)
+        out << prefix.str() << '"' << phase.name << "\"," << phase.allocations << ',' << phase.deallocations << ','
+            << phase.bytes << ',' << phase.peakRss << ',' << phase.milliseconds << '\n';
+    return (bool) out;
+}
+
+const string &ResultsLog::getPath() const {
+    return path;
+}
@@ -0,0 +1,50 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#ifndef TSP_RESULTSLOG_H
+#define TSP_RESULTSLOG_H
+
+
+#include <string>
+#include <vector>
+#include "Graph.h"
+#include "MemoryProfiler.h"
+
+class ResultsLog {
+public:
+    /**@brief Construtor com parâmetros. Prepara o registo de resultados no ficheiro CSV file, criando a pasta directory se ainda não existir.
+     *
+     * Complexidade Temporal: O(1)
+     * @param directory pasta do ficheiro de resultados
+     * @param file nome do ficheiro de resultados
+     */
+    explicit ResultsLog(std::string directory = "../results/", const std::string &file = "results.csv");
+
+    /**@brief Acrescenta ao ficheiro de resultados uma linha por fase medida da execução do algoritmo algorithm sobre o conjunto de dados dataset (ou uma única linha, sem fase, se não houver fases). Escreve o cabeçalho se o ficheiro ainda não existir.
+     *
+     * Complexidade Temporal: O(f), sendo f o número de fases
+     * @param dataset conjunto de dados
+     * @param algorithm algoritmo
+     * @param cost custo do circuito encontrado (0 se não se aplica)
+     * @param milliseconds tempo de execução, em milissegundos
+     * @param graph grafo usado (número de nós e de arestas e memória ocupada)
+     * @param phases fases medidas
+     * @return true se a operação foi bem-sucedida, false caso contrário
+     */
+    bool append(const std::string &dataset, const std::string &algorithm, double cost, long milliseconds,
+                const Graph &graph, const std::vector<MemoryProfiler::Phase> &phases) const;
+
+    /**@brief Retorna o caminho do ficheiro de resultados.
+     *
+     * Complexidade Temporal: O(1)
+     * @return caminho do ficheiro de resultados
+     */
+    const std::string &getPath() const;
+
+private:
+    std::string path;
+};
+
+
+#endif //TSP_RESULTSLOG_H
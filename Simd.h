@@ -0,0 +1,167 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#ifndef TSP_SIMD_H
+#define TSP_SIMD_H
+
+
+#include <limits>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#define SIMD_WIDTH 8u
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define SIMD_WIDTH 4u
+#else
+#define SIMD_WIDTH 1u
+#endif
+
+/**@brief Arredonda count para o múltiplo seguinte da largura dos registos SIMD (em floats), para que os vetores possam ser processados sem iteração final escalar.
+ *
+ * Complexidade Temporal: O(1)
+ * @param count número de elementos
+ * @return número de elementos arredondado para um múltiplo da largura SIMD
+ */
+inline unsigned simdPadded(unsigned count) {
+    return (count + SIMD_WIDTH - 1) / SIMD_WIDTH * SIMD_WIDTH;
+}
+
+/**@brief Multiplica, elemento a elemento, weights por mask, guardando o resultado em out, e retorna a soma dos produtos. Usa AVX ou SSE2 quando disponíveis.
+ *
+ * Complexidade Temporal: O(n / W), sendo n o número de elementos e W a largura SIMD
+ * @param weights pesos (count elementos, múltiplo de SIMD_WIDTH)
+ * @param mask máscara (1 para elementos disponíveis, 0 caso contrário)
+ * @param out resultado da multiplicação
+ * @param count número de elementos (múltiplo de SIMD_WIDTH)
+ * @return soma dos produtos
+ */
+inline float simdMaskedWeights(const float *weights, const float *mask, float *out, unsigned count) {
+#if defined(__AVX__)
+    __m256 total = _mm256_setzero_ps();
+    for (unsigned k = 0; k < count; k += 8) {
+        __m256 product = _mm256_mul_ps(_mm256_loadu_ps(weights + k), _mm256_loadu_ps(mask + k));
+        _mm256_storeu_ps(out + k, product);
+        total = _mm256_add_ps(total, product);
+    }
+    float lanes[8];
+    _mm256_storeu_ps(lanes, total);
+    return ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3])) + ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7]));
+#elif defined(__SSE2__)
+    __m128 total = _mm_setzero_ps();
+    for (unsigned k = 0; k < count; k += 4) {
+        __m128 product = _mm_mul_ps(_mm_loadu_ps(weights + k), _mm_loadu_ps(mask + k));
+        _mm_storeu_ps(out + k, product);
+        total = _mm_add_ps(total, product);
+    }
+    float lanes[4];
+    _mm_storeu_ps(lanes, total);
+    return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+#else
+    float total = 0.0f;
+    for (unsigned k = 0; k < count; k++) {
+        out[k] = weights[k] * mask[k];
+        total += out[k];
+    }
+    return total;
+#endif
+}
+
+/**@brief Seleção por roleta: retorna o primeiro índice k tal que a soma acumulada de weights[0..k] ultrapassa target. Salta blocos inteiros de SIMD_WIDTH pesos somando-os com instruções SIMD.
+ *
+ * Complexidade Temporal: O(n / W + W), sendo n o número de elementos e W a largura SIMD
+ * @param weights pesos não negativos (count elementos, múltiplo de SIMD_WIDTH)
+ * @param count número de elementos (múltiplo de SIMD_WIDTH)
+ * @param target valor alvo, no intervalo [0, soma dos pesos)
+ * @return índice selecionado (o último índice com peso positivo se target não for ultrapassado por erros de arredondamento)
+ */
+inline unsigned simdRouletteSelect(const float *weights, unsigned count, float target) {
+    float accumulated = 0.0f;
+    unsigned block = 0;
+    for (; block + SIMD_WIDTH <= count; block += SIMD_WIDTH) {
+#if defined(__AVX__)
+        float lanes[8];
+        _mm256_storeu_ps(lanes, _mm256_loadu_ps(weights + block));
+        float sum = ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3])) + ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7]));
+#elif defined(__SSE2__)
+        __m128 v = _mm_loadu_ps(weights + block);
+        __m128 pairs = _mm_add_ps(v, _mm_movehl_ps(v, v));
+        float sum = _mm_cvtss_f32(_mm_add_ss(pairs, _mm_shuffle_ps(pairs, pairs, 1)));
+#else
+        float sum = weights[block];
+#endif
+        if (accumulated + sum > target)
+            break;
+        accumulated += sum;
+    }
+    for (unsigned k = block; k < count; k++) {
+        accumulated += weights[k];
+        if (weights[k] > 0.0f && accumulated > target)
+            return k;
+    }
+    unsigned k = count;
+    while (k > 0 && weights[k - 1] <= 0.0f)
+        k--;
+    return k > 0 ? k - 1 : 0;
+}
+
+
+/**@brief Determina o máximo de base + edges[k] - first[k] - second[k], para k entre 0 e count - 1 (ganho de uma troca 2-opt para cada candidato), com instruções SIMD, e a primeira posição onde é atingido.
+ *
+ * Complexidade Temporal: O(n / W + W), sendo n o número de elementos e W a largura SIMD (mais O(n) para encontrar a posição, apenas se o máximo ultrapassar threshold)
+ * @param base termo constante
+ * @param edges primeiro vetor de termos somados
+ * @param first primeiro vetor de termos subtraídos
+ * @param second segundo vetor de termos subtraídos
+ * @param count número de elementos
+ * @param threshold valor a partir do qual interessa a posição do máximo
+ * @param position posição do máximo (apenas se o máximo ultrapassar threshold)
+ * @return máximo (-infinito se count for 0)
+ */
+inline float simdBestGain(float base, const float *edges, const float *first, const float *second, unsigned count,
+                          float threshold, unsigned &position) {
+    float best = -std::numeric_limits<float>::infinity();
+    unsigned k = 0;
+#if defined(__AVX__)
+    if (count >= 8) {
+        __m256 b = _mm256_set1_ps(base);
+        __m256 maximum = _mm256_set1_ps(best);
+        for (; k + 8 <= count; k += 8) {
+            __m256 gain = _mm256_sub_ps(_mm256_sub_ps(_mm256_add_ps(b, _mm256_loadu_ps(edges + k)),
+                                                      _mm256_loadu_ps(first + k)), _mm256_loadu_ps(second + k));
+            maximum = _mm256_max_ps(maximum, gain);
+        }
+        float lanes[8];
+        _mm256_storeu_ps(lanes, maximum);
+        for (float lane: lanes)
+            best = lane > best ? lane : best;
+    }
+#elif defined(__SSE2__)
+    if (count >= 4) {
+        __m128 b = _mm_set1_ps(base);
+        __m128 maximum = _mm_set1_ps(best);
+        for (; k + 4 <= count; k += 4) {
+            __m128 gain = _mm_sub_ps(_mm_sub_ps(_mm_add_ps(b, _mm_loadu_ps(edges + k)), _mm_loadu_ps(first + k)),
+                                     _mm_loadu_ps(second + k));
+            maximum = _mm_max_ps(maximum, gain);
+        }
+        float lanes[4];
+        _mm_storeu_ps(lanes, maximum);
+        for (float lane: lanes)
+            best = lane > best ? lane : best;
+    }
+#endif
+    for (; k < count; k++) {
+        float gain = base + edges[k] - first[k] - second[k];
+        best = gain > best ? gain : best;
+    }
+    if (best > threshold)
+        for (position = 0; position < count; position++)
+            if (base + edges[position] - first[position] - second[position] >= best)
+                break;
+    return best;
+}
+
+
+#endif //TSP_SIMD_H
@@ -0,0 +1,42 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#include "SmallTsp.h"
+#include "Graph.h"
+#include <stdexcept>
+
+using namespace std;
+
+template<>
+double SmallTsp::dispatch<1>(const Graph &, vector<unsigned> &) {
+    throw invalid_argument("O grafo tem demasiados nós para o algoritmo exato para grafos pequenos");
+}
+
+template<unsigned N>
+double SmallTsp::dispatch(const Graph &graph, vector<unsigned> &circuit) {
+    if (graph.size() != N)
+        return dispatch<N - 1>(graph, circuit);
+    double distances[N][N];
+    for (unsigned u = 0; u < N; u++)
+        for (unsigned v = 0; v < N; v++) {
+            const Edge *edge = u == v ? nullptr : graph.findEdge(u, v);
+            distances[u][v] = edge ? edge->getDistance() : numeric_limits<double>::infinity();
+        }
+    unsigned result[N + 1];
+    double cost = solve<N>(distances, result);
+    circuit.clear();
+    if (cost < numeric_limits<double>::infinity())
+        circuit.assign(result, result + N + 1);
+    return cost;
+}
+
+bool SmallTsp::supports(unsigned n) {
+    return n >= 2 && n <= SMALL_TSP_MAX;
+}
+
+double SmallTsp::solve(const Graph &graph, vector<unsigned> &circuit) {
+    if (!supports(graph.size()))
+        throw invalid_argument("O grafo tem demasiados nós para o algoritmo exato para grafos pequenos");
+    return dispatch<SMALL_TSP_MAX>(graph, circuit);
+}
@@ -0,0 +1,148 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#ifndef TSP_SMALLTSP_H
+#define TSP_SMALLTSP_H
+
+
+#include <limits>
+#include <vector>
+
+#define SMALL_TSP_MAX 16u
+
+class Graph;
+
+class SmallTsp {
+public:
+    /**@brief Indica se o grafo com n vértices pode ser resolvido pelo algoritmo exato para grafos pequenos.
+     *
+     * Complexidade Temporal: O(1)
+     * @param n número de vértices
+     * @return true se 2 <= n <= SMALL_TSP_MAX, false caso contrário
+     */
+    static bool supports(unsigned n);
+
+    /**@brief Resolve de forma exata o Travelling Salesperson Problem (TSP) para um grafo pequeno (até SMALL_TSP_MAX vértices), usando apenas as arestas do grafo. Copia as distâncias para uma matriz local e escolhe, pelo número de vértices, a instância de solve especializada em tempo de compilação.
+     *
+     * Complexidade Temporal: O(V!) no pior caso, sendo V o número de vértices (na prática, a poda reduz muito a pesquisa)
+     * @throws std::invalid_argument se o grafo não for suportado (ver supports)
+     * @param graph grafo
+     * @param circuit circuito ótimo (vazio se não existir nenhum circuito)
+     * @return custo do circuito ótimo (infinito se não existir nenhum circuito)
+     */
+    static double solve(const Graph &graph, std::vector<unsigned> &circuit);
+
+    /**@brief Resolve de forma exata o Travelling Salesperson Problem (TSP) sobre a matriz de distâncias distances, com N vértices conhecido em tempo de compilação: todos os dados ficam em arrays na pilha, os vértices visitados num bitmask e os vizinhos de cada vértice são explorados por ordem crescente de distância, com poda pelos custos mínimos de saída e de entrada dos vértices por visitar.
+     *
+     * Complexidade Temporal: O(N!) no pior caso
+     * @param distances matriz de distâncias (infinito se não existir aresta)
+     * @param circuit circuito ótimo, a começar e a acabar no vértice 0 (não alterado se não existir nenhum circuito)
+     * @return custo do circuito ótimo (infinito se não existir nenhum circuito)
+     */
+    template<unsigned N>
+    static double solve(const double (&distances)[N][N], unsigned (&circuit)[N + 1]);
+
+private:
+    /**@brief Copia as distâncias de graph para uma matriz local N × N e resolve com solve<N>, se o grafo tiver N vértices; caso contrário, passa a dispatch<N - 1>.
+     *
+     * Complexidade Temporal: a de solve<N>
+     * @param graph grafo
+     * @param circuit circuito ótimo (vazio se não existir nenhum circuito)
+     * @return custo do circuito ótimo (infinito se não existir nenhum circuito)
+     */
+    template<unsigned N>
+    static double dispatch(const Graph &graph, std::vector<unsigned> &circuit);
+
+    /**@brief Função auxiliar recursiva de solve<N>: estende o caminho path, com depth vértices, custo cost e vértices visitados visited.
+     *
+     * Complexidade Temporal: O((N - depth)!) no pior caso
+     * @param distances matriz de distâncias
+     * @param order vizinhos de cada vértice, por ordem crescente de distância
+     * @param minOut custo mínimo de saída de cada vértice
+     * @param minIn custo mínimo de entrada de cada vértice
+     * @param path caminho atual
+     * @param depth número de vértices do caminho atual
+     * @param visited bitmask dos vértices do caminho atual
+     * @param cost custo do caminho atual
+     * @param remainingOut soma dos custos mínimos de saída dos vértices por visitar
+     * @param remainingIn soma dos custos mínimos de entrada dos vértices por visitar
+     * @param best custo do melhor circuito encontrado
+     * @param circuit melhor circuito encontrado
+     */
+    template<unsigned N>
+    static void search(const double (&distances)[N][N], const unsigned (&order)[N][N], const double (&minOut)[N],
+                       const double (&minIn)[N], unsigned (&path)[N + 1], unsigned depth, unsigned visited,
+                       double cost, double remainingOut, double remainingIn, double &best,
+                       unsigned (&circuit)[N + 1]);
+};
+
+template<unsigned N>
+double SmallTsp::solve(const double (&distances)[N][N], unsigned (&circuit)[N + 1]) {
+    unsigned order[N][N];
+    double minOut[N], minIn[N];
+    double remainingOut = 0.0, remainingIn = 0.0;
+    for (unsigned v = 0; v < N; v++) {
+        for (unsigned u = 0; u < N; u++)
+            order[v][u] = u;
+        for (unsigned i = 1; i < N; i++)
+            for (unsigned j = i; j > 0 && distances[v][order[v][j]] < distances[v][order[v][j - 1]]; j--) {
+                unsigned temp = order[v][j];
+                order[v][j] = order[v][j - 1];
+                order[v][j - 1] = temp;
+            }
+        minOut[v] = minIn[v] = std::numeric_limits<double>::infinity();
+        for (unsigned u = 0; u < N; u++)
+            if (u != v) {
+                if (distances[v][u] < minOut[v])
+                    minOut[v] = distances[v][u];
+                if (distances[u][v] < minIn[v])
+                    minIn[v] = distances[u][v];
+            }
+        if (v != 0) {
+            remainingOut += minOut[v];
+            remainingIn += minIn[v];
+        }
+    }
+    unsigned path[N + 1];
+    path[0] = 0;
+    double best = std::numeric_limits<double>::infinity();
+    search<N>(distances, order, minOut, minIn, path, 1, 1u, 0.0, remainingOut, remainingIn, best, circuit);
+    return best;
+}
+
+template<unsigned N>
+void SmallTsp::search(const double (&distances)[N][N], const unsigned (&order)[N][N], const double (&minOut)[N],
+                      const double (&minIn)[N], unsigned (&path)[N + 1], unsigned depth, unsigned visited,
+                      double cost, double remainingOut, double remainingIn, double &best,
+                      unsigned (&circuit)[N + 1]) {
+    unsigned last = path[depth - 1];
+    if (depth == N) {
+        double total = cost + distances[last][0];
+        if (total < best) {
+            best = total;
+            for (unsigned i = 0; i < N; i++)
+                circuit[i] = path[i];
+            circuit[N] = 0;
+        }
+        return;
+    }
+    double bound = remainingOut + minOut[last] > remainingIn + minIn[0] ? remainingOut + minOut[last]
+                                                                          : remainingIn + minIn[0];
+    if (cost + bound >= best)
+        return;
+    for (unsigned k = 0; k < N; k++) {
+        unsigned next = order[last][k];
+        if (visited & (1u << next))
+            continue;
+        double extended = cost + distances[last][next];
+        if (extended + remainingOut >= best)
+            break;
+        path[depth] = next;
+        search<N>(distances, order, minOut, minIn, path, depth + 1, visited | (1u << next), extended,
+                  remainingOut - minOut[next], remainingIn - minIn[next], best, circuit);
+    }
+}
+
+
+#endif //TSP_SMALLTSP_H
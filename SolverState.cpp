@@ -0,0 +1,65 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#include "SolverState.h"
+
+using namespace std;
+
+SolverState::SolverState(unsigned n) : states(n) {}
+
+void SolverState::reset(double distance) {
+    for (VertexState &state: states) {
+        state.visited = false;
+        state.distance = distance;
+        state.path = nullptr;
+        state.queueIndex = 0;
+    }
+}
+
+void SolverState::reset(unsigned id, double distance) {
+    states[id].visited = false;
+    states[id].distance = distance;
+    states[id].path = nullptr;
+    states[id].queueIndex = 0;
+}
+
+bool SolverState::isVisited(unsigned id) const {
+    return states[id].visited;
+}
+
+double SolverState::getDistance(unsigned id) const {
+    return states[id].distance;
+}
+
+const Edge *SolverState::getPath(unsigned id) const {
+    return states[id].path;
+}
+
+void SolverState::setVisited(unsigned id, bool visited) {
+    states[id].visited = visited;
+}
+
+void SolverState::setDistance(unsigned id, double distance) {
+    states[id].distance = distance;
+}
+
+void SolverState::setPath(unsigned id, const Edge *path) {
+    states[id].path = path;
+}
+
+void SolverState::insert(unsigned id) {
+    queue.insert(&states[id]);
+}
+
+unsigned SolverState::extractMin() {
+    return queue.extractMin() - states.data();
+}
+
+void SolverState::decreaseKey(unsigned id) {
+    queue.decreaseKey(&states[id]);
+}
+
+bool SolverState::empty() {
+    return queue.empty();
+}
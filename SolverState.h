@@ -0,0 +1,136 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#ifndef TSP_SOLVERSTATE_H
+#define TSP_SOLVERSTATE_H
+
+
+#include <vector>
+#include "Edge.h"
+#include "MutablePriorityQueue.h"
+
+struct VertexState {
+    bool visited = false;
+    double distance = 0.0;
+    const Edge *path = nullptr;
+    int queueIndex = 0;
+
+    /**@brief Compara o estado e state quanto à sua distância.
+     *
+     * Complexidade Temporal: O(1)
+     * @param state estado com o qual comparar
+     * @return true se a distância do estado é inferior à de state, false caso contrário
+     */
+    bool operator<(const VertexState &state) const {
+        return distance < state.distance;
+    }
+};
+
+class SolverState {
+public:
+    /**@brief Construtor com parâmetros. Constrói o estado de uma execução de um algoritmo sobre um grafo com n vértices, guardado num vetor contíguo indexado pelo id do vértice.
+     *
+     * Complexidade Temporal: O(n)
+     * @param n número de vértices do grafo
+     */
+    explicit SolverState(unsigned n);
+
+    /**@brief Repõe o estado de todos os vértices: não visitados, com distância distance e sem aresta predecessora.
+     *
+     * Complexidade Temporal: O(n), sendo n o número de vértices
+     * @param distance distância inicial de todos os vértices
+     */
+    void reset(double distance = 0.0);
+
+    /**@brief Repõe o estado do vértice de id id: não visitado, com distância distance e sem aresta predecessora. Permite reutilizar o estado entre execuções repondo apenas os vértices alcançados.
+     *
+     * Complexidade Temporal: O(1)
+     * @param id id do vértice
+     * @param distance distância inicial do vértice
+     */
+    void reset(unsigned id, double distance);
+
+    /**@brief Indica se o vértice de id id foi visitado.
+     *
+     * Complexidade Temporal: O(1)
+     * @param id id do vértice
+     * @return true se o vértice foi visitado, false caso contrário
+     */
+    bool isVisited(unsigned id) const;
+
+    /**@brief Retorna a distância do vértice de id id.
+     *
+     * Complexidade Temporal: O(1)
+     * @param id id do vértice
+     * @return distância do vértice
+     */
+    double getDistance(unsigned id) const;
+
+    /**@brief Retorna a aresta predecessora do vértice de id id no caminho atual.
+     *
+     * Complexidade Temporal: O(1)
+     * @param id id do vértice
+     * @return aresta predecessora do vértice no caminho atual
+     */
+    const Edge *getPath(unsigned id) const;
+
+    /**@brief Define o estado visitado do vértice de id id como visited.
+     *
+     * Complexidade Temporal: O(1)
+     * @param id id do vértice
+     * @param visited novo estado visitado do vértice
+     */
+    void setVisited(unsigned id, bool visited);
+
+    /**@brief Define a distância do vértice de id id como distance.
+     *
+     * Complexidade Temporal: O(1)
+     * @param id id do vértice
+     * @param distance nova distância do vértice
+     */
+    void setDistance(unsigned id, double distance);
+
+    /**@brief Define a aresta predecessora do vértice de id id como path.
+     *
+     * Complexidade Temporal: O(1)
+     * @param id id do vértice
+     * @param path nova aresta predecessora do vértice
+     */
+    void setPath(unsigned id, const Edge *path);
+
+    /**@brief Insere o vértice de id id na fila de prioridade mutável, ordenada pela distância.
+     *
+     * Complexidade Temporal: O(log n), sendo n o número de elementos na fila de prioridade mutável
+     * @param id id do vértice a inserir
+     */
+    void insert(unsigned id);
+
+    /**@brief Retira da fila de prioridade mutável o vértice com menor distância.
+     *
+     * Complexidade Temporal: O(log n), sendo n o número de elementos na fila de prioridade mutável
+     * @return id do vértice com menor distância
+     */
+    unsigned extractMin();
+
+    /**@brief Atualiza a posição do vértice de id id na fila de prioridade mutável, depois de a sua distância ter diminuído.
+     *
+     * Complexidade Temporal: O(log n), sendo n o número de elementos na fila de prioridade mutável
+     * @param id id do vértice a atualizar
+     */
+    void decreaseKey(unsigned id);
+
+    /**@brief Verifica se a fila de prioridade mutável está vazia.
+     *
+     * Complexidade Temporal: O(1)
+     * @return true se a fila de prioridade mutável está vazia, false caso contrário
+     */
+    bool empty();
+
+private:
+    std::vector<VertexState> states;
+    MutablePriorityQueue<VertexState> queue;
+};
+
+
+#endif //TSP_SOLVERSTATE_H
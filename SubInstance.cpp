@@ -0,0 +1,148 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#include "SubInstance.h"
+#include "LocalSearch.h"
+#include "TourConstruction.h"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+using namespace std;
+
+SubInstance::SubInstance(const Graph &graph, const vector<unsigned> &ids) : graph(graph), ids(ids),
+                                                                            gathered(ids.size(), false) {
+    for (unsigned i = 0; i < ids.size(); i++)
+        if (!graph.findVertex(ids[i]) || !index.emplace(ids[i], i).second)
+            throw invalid_argument("Subconjunto inválido");
+}
+
+unsigned SubInstance::size() const {
+    return ids.size();
+}
+
+unsigned SubInstance::getId(unsigned i) const {
+    return ids[i];
+}
+
+unsigned SubInstance::getIndex(unsigned id) const {
+    auto it = index.find(id);
+    return it == index.end() ? size() : it->second;
+}
+
+double SubInstance::getDistance(unsigned i, unsigned j) {
+    return getRow(i)[j];
+}
+
+const double *SubInstance::getRow(unsigned i) {
+    unsigned m = size();
+    if (distances.empty())
+        distances.assign((size_t) m * m, numeric_limits<double>::infinity());
+    double *row = distances.data() + (size_t) i * m;
+    if (gathered[i])
+        return row;
+    gathered[i] = true;
+    rows++;
+    row[i] = 0.0;
+    if (graph.isComplete()) {
+        for (unsigned j = 0; j < m; j++)
+            if (j != i)
+                row[j] = graph.findEdge(ids[i], ids[j])->getDistance();
+        return row;
+    }
+
+    vector<unsigned> path;
+    search(i, m, row, path);
+    return row;
+}
+
+double SubInstance::getPath(unsigned i, unsigned j, vector<unsigned> &path) {
+    if (i == j)
+        return 0.0;
+    if (graph.isComplete()) {
+        path.push_back(ids[j]);
+        return graph.findEdge(ids[i], ids[j])->getDistance();
+    }
+    return search(i, j, nullptr, path);
+}
+
+unsigned SubInstance::getGatheredRows() const {
+    return rows;
+}
+
+double SubInstance::solve(vector<unsigned> &circuit) {
+    unsigned m = size();
+    circuit.clear();
+    if (!m)
+        return 0.0;
+    const double *first = getRow(0);
+    for (unsigned j = 0; j < m; j++)
+        if (first[j] == numeric_limits<double>::infinity())
+            throw invalid_argument("O subconjunto não é conexo");
+    for (unsigned i = 1; i < m; i++)
+        getRow(i);
+    MetricClosure closure(m, move(distances));
+    distances.clear();
+    gathered.assign(m, false);
+    vector<unsigned> tour = TourConstruction::greedyEdge(closure);
+    double cost = LocalSearch(closure).twoOpt(tour);
+    vector<unsigned> stops = TourConstruction::toCircuit(tour);
+    if (graph.isComplete()) {
+        for (unsigned v: stops)
+            circuit.push_back(ids[v]);
+        return cost;
+    }
+    circuit.push_back(ids[stops[0]]);
+    for (unsigned k = 0; k + 1 < stops.size(); k++)
+        search(stops[k], stops[k + 1], nullptr, circuit);
+    return cost;
+}
+
+double SubInstance::search(unsigned source, unsigned target, double *row, vector<unsigned> &path) {
+    unsigned m = size();
+    if (!state) {
+        state.reset(new SolverState(graph.size()));
+        state->reset(numeric_limits<double>::infinity());
+    }
+    touched.assign(1, ids[source]);
+    state->setDistance(ids[source], 0.0);
+    state->insert(ids[source]);
+    unsigned remaining = target < m ? 1 : m;
+    while (!state->empty() && remaining) {
+        unsigned v = state->extractMin();
+        state->setVisited(v, true);
+        auto it = index.find(v);
+        if (it != index.end() && (target == m || it->second == target)) {
+            if (row)
+                row[it->second] = state->getDistance(v);
+            remaining--;
+        }
+        for (Edge *edge: graph.findVertex(v)->getAdj()) {
+            unsigned u = edge->getDest()->getId();
+            double distance = state->getDistance(u);
+            if (!state->isVisited(u) && state->getDistance(v) + edge->getDistance() < distance) {
+                state->setDistance(u, state->getDistance(v) + edge->getDistance());
+                state->setPath(u, edge);
+                if (distance == numeric_limits<double>::infinity()) {
+                    touched.push_back(u);
+                    state->insert(u);
+                } else {
+                    state->decreaseKey(u);
+                }
+            }
+        }
+    }
+    double result = target < m && !remaining ? state->getDistance(ids[target]) : numeric_limits<double>::infinity();
+    if (target < m && !remaining) {
+        size_t begin = path.size();
+        for (unsigned v = ids[target]; v != ids[source]; v = state->getPath(v)->getOrig()->getId())
+            path.push_back(v);
+        reverse(path.begin() + (long) begin, path.end());
+    }
+    while (!state->empty())
+        state->extractMin();
+    for (unsigned v: touched)
+        state->reset(v, numeric_limits<double>::infinity());
+    return result;
+}
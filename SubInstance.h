@@ -0,0 +1,119 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#ifndef TSP_SUBINSTANCE_H
+#define TSP_SUBINSTANCE_H
+
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include "Graph.h"
+#include "SolverState.h"
+
+class SubInstance {
+public:
+    /**@brief Construtor com parâmetros. Constrói uma vista sobre o subconjunto ids dos vértices de graph, sem copiar o grafo: cada vértice do subconjunto tem um índice local (a sua posição em ids) e as distâncias são obtidas do grafo apenas quando são pedidas.
+     *
+     * Complexidade Temporal: O(m), sendo m o tamanho do subconjunto (em média)
+     * @throws std::invalid_argument se algum id não existe no grafo ou está repetido
+     * @param graph grafo
+     * @param ids ids dos vértices do subconjunto
+     */
+    SubInstance(const Graph &graph, const std::vector<unsigned> &ids);
+
+    /**@brief Retorna o número de vértices do subconjunto.
+     *
+     * Complexidade Temporal: O(1)
+     * @return número de vértices do subconjunto
+     */
+    unsigned size() const;
+
+    /**@brief Retorna o id no grafo do vértice de índice local i.
+     *
+     * Complexidade Temporal: O(1)
+     * @param i índice local do vértice
+     * @return id do vértice no grafo
+     */
+    unsigned getId(unsigned i) const;
+
+    /**@brief Retorna o índice local do vértice de id id no grafo.
+     *
+     * Complexidade Temporal: O(1) (em média)
+     * @param id id do vértice no grafo
+     * @return índice local do vértice (size() se não pertence ao subconjunto)
+     */
+    unsigned getIndex(unsigned id) const;
+
+    /**@brief Retorna a distância entre os vértices de índices locais i e j, reunindo a linha i da submatriz de distâncias se ainda não foi reunida.
+     *
+     * Complexidade Temporal: O(1) se a linha já foi reunida, a de getRow caso contrário
+     * @param i índice local do vértice de origem
+     * @param j índice local do vértice de destino
+     * @return distância entre os dois vértices (infinito se não existe caminho)
+     */
+    double getDistance(unsigned i, unsigned j);
+
+    /**@brief Retorna a linha i da submatriz de distâncias, reunindo-a se ainda não foi reunida: a partir das arestas do grafo, se for completo, ou dos caminhos mais curtos (algoritmo de Dijkstra a partir do vértice, que pára quando todos os vértices do subconjunto foram alcançados), caso contrário.
+     *
+     * O estado do algoritmo de Dijkstra é reutilizado entre linhas: só os vértices alcançados em cada pesquisa são repostos.
+     *
+     * Complexidade Temporal: O(m) se o grafo for completo, O(E' log(V')) caso contrário (na primeira vez, mais O(V) na primeira linha), sendo m o tamanho do subconjunto, V o número de vértices do grafo e V' e E' o número de vértices e arestas alcançados pela pesquisa
+     * @param i índice local do vértice
+     * @return apontador para o início da linha (com size() elementos)
+     */
+    const double *getRow(unsigned i);
+
+    /**@brief Acrescenta a path o caminho mais curto entre os vértices de índices locais i e j (a aresta entre eles, se o grafo for completo), sem reunir linhas da submatriz de distâncias: o algoritmo de Dijkstra pára quando alcança j.
+     *
+     * Complexidade Temporal: O(1) se o grafo for completo, O(E' log(V')) caso contrário, sendo V' e E' o número de vértices e arestas alcançados pela pesquisa
+     * @param i índice local do vértice de origem
+     * @param j índice local do vértice de destino
+     * @param path caminho ao qual são acrescentados os ids no grafo dos vértices do caminho, sem o vértice de origem
+     * @return distância do caminho (infinito se j não é alcançável a partir de i)
+     */
+    double getPath(unsigned i, unsigned j, std::vector<unsigned> &path);
+
+    /**@brief Retorna o número de linhas da submatriz de distâncias já reunidas.
+     *
+     * Complexidade Temporal: O(1)
+     * @return número de linhas reunidas
+     */
+    unsigned getGatheredRows() const;
+
+    /**@brief Resolve (de forma aproximada) o Travelling Salesperson Problem (TSP) sobre o subconjunto: reúne a submatriz de distâncias, constrói um circuito com Greedy Edge e otimiza-o com 2-opt.
+     * Se o grafo não for completo, cada troço do circuito entre dois vértices do subconjunto é expandido no caminho mais curto correspondente, pelo que o circuito usa apenas arestas do grafo.
+     *
+     * Complexidade Temporal: O(m (m + E log(V)) + m<SUP>2</SUP> log(m)), sendo m o tamanho do subconjunto, V o número de vértices e E o número de arestas do grafo (mais o 2-opt)
+     * @throws std::invalid_argument se algum vértice do subconjunto não é alcançável a partir de outro
+     * @param circuit circuito encontrado, com os ids dos vértices no grafo (começa e acaba no primeiro vértice do subconjunto; inclui os vértices intermédios dos caminhos mais curtos se o grafo não for completo)
+     * @return custo do circuito encontrado
+     */
+    double solve(std::vector<unsigned> &circuit);
+
+private:
+    const Graph &graph;
+    std::vector<unsigned> ids;
+    std::unordered_map<unsigned, unsigned> index;
+    std::vector<double> distances;
+    std::vector<char> gathered;
+    unsigned rows = 0;
+    std::unique_ptr<SolverState> state;
+    std::vector<unsigned> touched;
+
+    /**@brief Executa o algoritmo de Dijkstra a partir do vértice de índice local source, reutilizando o estado entre pesquisas (só os vértices alcançados são repostos no fim).
+     * Se target for size(), pára quando todos os vértices do subconjunto foram alcançados e guarda as distâncias em row; caso contrário, pára quando alcança o vértice de índice local target e acrescenta a path o caminho mais curto até ele (sem o vértice de origem).
+     *
+     * Complexidade Temporal: O(E' log(V')), sendo V' e E' o número de vértices e arestas alcançados pela pesquisa
+     * @param source índice local do vértice de origem
+     * @param target índice local do vértice de destino, ou size() para todos os vértices do subconjunto
+     * @param row linha da submatriz de distâncias a preencher (ignorada se for nullptr)
+     * @param path caminho ao qual é acrescentado o caminho mais curto até target, com os ids dos vértices no grafo
+     * @return distância até target (infinito se target for size() ou não for alcançável)
+     */
+    double search(unsigned source, unsigned target, double *row, std::vector<unsigned> &path);
+};
+
+
+#endif //TSP_SUBINSTANCE_H
@@ -0,0 +1,72 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#ifndef TSP_THREADPOOL_H
+#define TSP_THREADPOOL_H
+
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+class ThreadPool {
+public:
+    /**@brief Construtor com parâmetros. Constrói um conjunto de threads trabalhadoras que executam as tarefas submetidas por ordem de chegada.
+     *
+     * Complexidade Temporal: O(n), sendo n o número de threads
+     * @param threads número de threads (se 0, usa o número de threads suportadas pelo hardware)
+     */
+    explicit ThreadPool(unsigned threads = 0);
+
+    /**@brief Destrutor. Espera que todas as tarefas submetidas terminem e termina as threads.
+     *
+     * Complexidade Temporal: O(n), sendo n o número de threads
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    /**@brief Submete a tarefa task para ser executada por uma das threads.
+     *
+     * Complexidade Temporal: O(1)
+     * @param task tarefa a executar
+     */
+    void submit(std::function<void()> task);
+
+    /**@brief Espera que todas as tarefas submetidas até ao momento terminem.
+     *
+     * Complexidade Temporal: O(1), sem contar com o tempo de execução das tarefas
+     */
+    void wait();
+
+    /**@brief Retorna o número de threads trabalhadoras.
+     *
+     * Complexidade Temporal: O(1)
+     * @return número de threads trabalhadoras
+     */
+    unsigned size() const;
+
+private:
+    std::vector<std::thread> workers;
+    std::queue<std::function<void()>> tasks;
+    std::mutex mutex;
+    std::condition_variable available;
+    std::condition_variable finished;
+    unsigned running = 0;
+    bool stopping = false;
+
+    /**@brief Ciclo executado por cada thread trabalhadora: retira tarefas da fila e executa-as até o conjunto ser destruído.
+     *
+     * Complexidade Temporal: amplamente variável de acordo com as tarefas submetidas
+     */
+    void work();
+};
+
+
+#endif //TSP_THREADPOOL_H
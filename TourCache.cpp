@@ -0,0 +1,182 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#include "TourCache.h"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <random>
+#include <sstream>
+#include <sys/stat.h>
+
+#ifdef _WIN32
+#include <direct.h>
+#include <io.h>
+#include <sys/locking.h>
+#include <fcntl.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+static uint64_t mix(uint64_t x) {
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+static uint64_t bits(double value) {
+    uint64_t result;
+    memcpy(&result, &value, sizeof(result));
+    return result;
+}
+
+/**@brief Abre (criando-o, se necessário) o ficheiro de bloqueio file e bloqueia-o em exclusivo, esperando que outras execuções o libertem.
+ *
+ * Complexidade Temporal: O(1), mais o tempo de espera
+ * @param file caminho do ficheiro de bloqueio
+ * @return descritor do ficheiro bloqueado (-1 se não foi possível bloqueá-lo)
+ */
+static int lockFile(const string &file) {
+#ifdef _WIN32
+    int descriptor = _open(file.c_str(), _O_CREAT | _O_RDWR, _S_IREAD | _S_IWRITE);
+    if (descriptor < 0)
+        return -1;
+    while (_locking(descriptor, _LK_LOCK, 1) != 0);
+#else
+    int descriptor = open(file.c_str(), O_CREAT | O_RDWR, 0644);
+    if (descriptor < 0)
+        return -1;
+    while (flock(descriptor, LOCK_EX) != 0)
+        if (errno != EINTR) {
+            close(descriptor);
+            return -1;
+        }
+#endif
+    return descriptor;
+}
+
+/**@brief Liberta o bloqueio obtido com lockFile e fecha o ficheiro.
+ *
+ * Complexidade Temporal: O(1)
+ * @param descriptor descritor do ficheiro bloqueado
+ */
+static void unlockFile(int descriptor) {
+    if (descriptor < 0)
+        return;
+#ifdef _WIN32
+    _lseek(descriptor, 0, SEEK_SET);
+    _locking(descriptor, _LK_UNLCK, 1);
+    _close(descriptor);
+#else
+    flock(descriptor, LOCK_UN);
+    close(descriptor);
+#endif
+}
+
+TourCache::TourCache(const Graph &graph, string directory) : directory(move(directory)),
+                                                               graphFingerprint(fingerprint(graph)) {
+#ifdef _WIN32
+    _mkdir(this->directory.c_str());
+#else
+    mkdir(this->directory.c_str(), 0755);
+#endif
+}
+
+bool TourCache::lookup(const string &params, vector<unsigned> &circuit, double &cost) const {
+    return read(path(params), params, circuit, cost);
+}
+
+bool TourCache::best(vector<unsigned> &circuit, double &cost) const {
+    return read(path("best"), "best", circuit, cost);
+}
+
+bool TourCache::store(const string &params, const vector<unsigned> &circuit, double cost) const {
+    if (!write(path(params), params, circuit, cost))
+        return false;
+    int descriptor = lockFile(path("best") + ".lock");
+    vector<unsigned> known;
+    double knownCost;
+    if (!best(known, knownCost) || cost < knownCost)
+        write(path("best"), "best", circuit, cost);
+    unlockFile(descriptor);
+    return true;
+}
+
+uint64_t TourCache::getFingerprint() const {
+    return graphFingerprint;
+}
+
+uint64_t TourCache::fingerprint(const Graph &graph) {
+    uint64_t hash = mix(graph.size());
+    for (unsigned v = 0; v < graph.size(); v++) {
+        const Vertex *vertex = graph.findVertex(v);
+        hash += mix(mix(mix(v) ^ bits(vertex->getLongitude())) ^ bits(vertex->getLatitude()));
+        for (const Edge *edge: vertex->getAdj()) {
+            unsigned dest = edge->getDest()->getId();
+            if (v < dest)
+                hash += mix(mix(mix(((uint64_t) v << 32) | dest) ^ bits(edge->getDistance())) + 1);
+        }
+    }
+    return hash;
+}
+
+string TourCache::path(const string &key) const {
+    uint64_t hash = mix(key.size());
+    for (unsigned char c: key)
+        hash = mix(hash ^ c);
+    ostringstream name;
+    name << directory << hex << setw(16) << setfill('0') << graphFingerprint << '-' << setw(16) << hash << ".tour";
+    return name.str();
+}
+
+bool TourCache::read(const string &file, const string &key, vector<unsigned> &circuit, double &cost) {
+    ifstream in(file);
+    string line;
+    if (!in.is_open() || !getline(in, line) || line != key)
+        return false;
+    unsigned size;
+    if (!(in >> cost >> size))
+        return false;
+    vector<unsigned> result(size);
+    for (unsigned &v: result)
+        if (!(in >> v))
+            return false;
+    circuit = move(result);
+    return true;
+}
+
+bool TourCache::write(const string &file, const string &key, const vector<unsigned> &circuit, double cost) {
+    ostringstream temporary;
+    temporary << file << ".tmp" << hex << random_device()();
+    {
+        ofstream out(temporary.str());
+        if (!out.is_open())
+            return false;
+        out << key << '\n' << setprecision(17) << cost << '\n' << circuit.size() << '\n';
+        for (unsigned v: circuit)
+            out << v << ' ';
+        out << '\n';
+        if (!out.good()) {
+            out.close();
+            remove(temporary.str().c_str());
+            return false;
+        }
+    }
+#ifdef _WIN32
+    remove(file.c_str());
+#endif
+    if (rename(temporary.str().c_str(), file.c_str()) != 0) {
+        remove(temporary.str().c_str());
+        return false;
+    }
+    return true;
+}
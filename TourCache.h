@@ -0,0 +1,105 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#ifndef TSP_TOURCACHE_H
+#define TSP_TOURCACHE_H
+
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Graph.h"
+
+class TourCache {
+public:
+    /**@brief Construtor com parâmetros. Constrói a cache persistente de circuitos do grafo graph, guardada no diretório directory (criado se não existir).
+     *
+     * Complexidade Temporal: O(V + E), sendo V o número de vértices e E o número de arestas do grafo (cálculo da impressão digital)
+     * @param graph grafo
+     * @param directory diretório onde são guardados os ficheiros da cache
+     */
+    explicit TourCache(const Graph &graph, std::string directory = "../cache/");
+
+    /**@brief Procura na cache o circuito guardado para o grafo com os parâmetros params.
+     *
+     * Complexidade Temporal: O(n), sendo n o tamanho do circuito
+     * @param params algoritmo e parâmetros usados (por exemplo, "heuristica;gap=5")
+     * @param circuit circuito guardado (se existir)
+     * @param cost custo do circuito guardado (se existir)
+     * @return true se existe um circuito guardado para o grafo com os parâmetros params, false caso contrário
+     */
+    bool lookup(const std::string &params, std::vector<unsigned> &circuit, double &cost) const;
+
+    /**@brief Procura na cache o melhor circuito conhecido para o grafo, independentemente dos parâmetros com que foi encontrado (para ser usado como ponto de partida).
+     *
+     * Complexidade Temporal: O(n), sendo n o tamanho do circuito
+     * @param circuit melhor circuito conhecido (se existir)
+     * @param cost custo do melhor circuito conhecido (se existir)
+     * @return true se existe um circuito guardado para o grafo, false caso contrário
+     */
+    bool best(std::vector<unsigned> &circuit, double &cost) const;
+
+    /**@brief Guarda na cache o circuito circuit, de custo cost, encontrado com os parâmetros params, e atualiza o melhor circuito conhecido para o grafo se for melhor.
+     * Cada ficheiro é escrito num ficheiro temporário e depois substitui o anterior de forma atómica (rename), pelo que execuções concorrentes nunca leem ficheiros incompletos. A leitura, comparação e substituição do melhor circuito conhecido são feitas com um bloqueio exclusivo (flock) sobre um ficheiro .lock, pelo que uma execução concorrente nunca substitui um circuito melhor por um pior.
+     *
+     * Complexidade Temporal: O(n), sendo n o tamanho do circuito
+     * @param params algoritmo e parâmetros usados
+     * @param circuit circuito a guardar
+     * @param cost custo do circuito a guardar
+     * @return true se o circuito foi guardado, false caso contrário (por exemplo, se não foi possível escrever no diretório)
+     */
+    bool store(const std::string &params, const std::vector<unsigned> &circuit, double cost) const;
+
+    /**@brief Retorna a impressão digital (dispersão do conteúdo: vértices, coordenadas e arestas) do grafo.
+     *
+     * Complexidade Temporal: O(1)
+     * @return impressão digital do grafo
+     */
+    std::uint64_t getFingerprint() const;
+
+    /**@brief Calcula a impressão digital de graph: combina, de forma independente da ordem de leitura, a dispersão de cada vértice (id e coordenadas) e de cada aresta (extremidades e distância).
+     *
+     * Complexidade Temporal: O(V + E), sendo V o número de vértices e E o número de arestas do grafo
+     * @param graph grafo
+     * @return impressão digital do grafo
+     */
+    static std::uint64_t fingerprint(const Graph &graph);
+
+private:
+    std::string directory;
+    std::uint64_t graphFingerprint;
+
+    /**@brief Retorna o caminho do ficheiro da cache com a chave key para o grafo. O nome é formado pela impressão digital do grafo e por um hash dos bytes da chave calculado com a mesma função de mistura, pelo que não depende da implementação da biblioteca padrão.
+     *
+     * Complexidade Temporal: O(k), sendo k o tamanho da chave
+     * @param key chave (parâmetros, ou "best" para o melhor circuito conhecido)
+     * @return caminho do ficheiro
+     */
+    std::string path(const std::string &key) const;
+
+    /**@brief Lê o ficheiro file da cache, verificando se foi escrito para a chave key.
+     *
+     * Complexidade Temporal: O(n), sendo n o tamanho do circuito
+     * @param file caminho do ficheiro
+     * @param key chave esperada
+     * @param circuit circuito lido
+     * @param cost custo lido
+     * @return true se o ficheiro existe e corresponde à chave, false caso contrário
+     */
+    static bool read(const std::string &file, const std::string &key, std::vector<unsigned> &circuit, double &cost);
+
+    /**@brief Escreve o ficheiro file da cache de forma atómica: escreve num ficheiro temporário no mesmo diretório e substitui file através de rename.
+     *
+     * Complexidade Temporal: O(n), sendo n o tamanho do circuito
+     * @param file caminho do ficheiro
+     * @param key chave
+     * @param circuit circuito
+     * @param cost custo
+     * @return true se o ficheiro foi escrito, false caso contrário
+     */
+    static bool write(const std::string &file, const std::string &key, const std::vector<unsigned> &circuit, double cost);
+};
+
+
+#endif //TSP_TOURCACHE_H
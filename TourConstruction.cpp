@@ -0,0 +1,231 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#include "TourConstruction.h"
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+
+using namespace std;
+
+#define HILBERT_SIDE 65536u
+
+vector<unsigned> TourConstruction::nearestNeighbor(const MetricClosure &closure, unsigned start, mt19937 &rng,
+                                                   unsigned candidates) {
+    unsigned n = closure.size();
+    candidates = max(1u, candidates);
+    vector<char> visited(n, false);
+    vector<unsigned> tour;
+    tour.reserve(n);
+    vector<unsigned> nearest;
+    unsigned current = start;
+    visited[current] = true;
+    tour.push_back(current);
+    for (unsigned i = 1; i < n; i++) {
+        const double *row = closure.getRow(current);
+        nearest.clear();
+        for (unsigned j = 0; j < n; j++) {
+            if (visited[j])
+                continue;
+            if (nearest.size() < candidates)
+                nearest.push_back(j);
+            else if (row[j] < row[nearest.back()])
+                nearest.back() = j;
+            else
+                continue;
+            for (unsigned k = nearest.size() - 1; k > 0 && row[nearest[k]] < row[nearest[k - 1]]; k--)
+                swap(nearest[k], nearest[k - 1]);
+        }
+        current = nearest[uniform_int_distribution<unsigned>(0, nearest.size() - 1)(rng)];
+        visited[current] = true;
+        tour.push_back(current);
+    }
+    return tour;
+}
+
+vector<unsigned> TourConstruction::mstPreorder(const MetricClosure &closure, unsigned root, mt19937 *rng) {
+    unsigned n = closure.size();
+    vector<double> distance(n, numeric_limits<double>::infinity());
+    vector<unsigned> parent(n, root);
+    vector<char> inTree(n, false);
+    vector<vector<unsigned>> children(n);
+    distance[root] = 0.0;
+    for (unsigned i = 0; i < n; i++) {
+        unsigned v = n;
+        for (unsigned j = 0; j < n; j++)
+            if (!inTree[j] && (v == n || distance[j] < distance[v]))
+                v = j;
+        inTree[v] = true;
+        if (v != root)
+            children[parent[v]].push_back(v);
+        const double *row = closure.getRow(v);
+        for (unsigned j = 0; j < n; j++)
+            if (!inTree[j] && row[j] < distance[j]) {
+                distance[j] = row[j];
+                parent[j] = v;
+            }
+    }
+
+    vector<unsigned> tour;
+    tour.reserve(n);
+    vector<unsigned> stack = {root};
+    while (!stack.empty()) {
+        unsigned v = stack.back();
+        stack.pop_back();
+        tour.push_back(v);
+        if (rng)
+            shuffle(children[v].begin(), children[v].end(), *rng);
+        for (auto it = children[v].rbegin(); it != children[v].rend(); it++)
+            stack.push_back(*it);
+    }
+    return tour;
+}
+
+vector<unsigned> TourConstruction::greedyEdge(const MetricClosure &closure, unsigned neighbors) {
+    unsigned n = closure.size();
+    if (n < 3) {
+        vector<unsigned> tour(n);
+        iota(tour.begin(), tour.end(), 0);
+        return tour;
+    }
+    unsigned k = min(max(1u, neighbors), n - 1);
+    vector<pair<unsigned, unsigned>> candidates;
+    candidates.reserve((size_t) n * k);
+    vector<unsigned> others(n - 1);
+    for (unsigned i = 0; i < n; i++) {
+        for (unsigned j = 0, o = 0; j < n; j++)
+            if (j != i)
+                others[o++] = j;
+        const double *row = closure.getRow(i);
+        nth_element(others.begin(), others.begin() + (k - 1), others.end(), [row](unsigned a, unsigned b) {
+            return row[a] < row[b];
+        });
+        for (unsigned c = 0; c < k; c++)
+            candidates.emplace_back(min(i, others[c]), max(i, others[c]));
+    }
+    auto shorter = [&closure](const pair<unsigned, unsigned> &a, const pair<unsigned, unsigned> &b) {
+        return closure.getDistance(a.first, a.second) < closure.getDistance(b.first, b.second);
+    };
+    sort(candidates.begin(), candidates.end());
+    candidates.erase(unique(candidates.begin(), candidates.end()), candidates.end());
+    sort(candidates.begin(), candidates.end(), shorter);
+
+    vector<unsigned> component(n);
+    iota(component.begin(), component.end(), 0);
+    auto find = [&component](unsigned v) {
+        while (component[v] != v)
+            v = component[v] = component[component[v]];
+        return v;
+    };
+    vector<unsigned> degree(n, 0);
+    vector<vector<unsigned>> adjacent(n);
+    unsigned accepted = 0;
+    auto accept = [&](const vector<pair<unsigned, unsigned>> &edges) {
+        for (const auto &edge: edges) {
+            unsigned u = edge.first;
+            unsigned v = edge.second;
+            if (degree[u] == 2 || degree[v] == 2)
+                continue;
+            unsigned cu = find(u);
+            unsigned cv = find(v);
+            if (cu == cv)
+                continue;
+            component[cu] = cv;
+            degree[u]++;
+            degree[v]++;
+            adjacent[u].push_back(v);
+            adjacent[v].push_back(u);
+            if (++accepted == n - 1)
+                return;
+        }
+    };
+    accept(candidates);
+    if (accepted < n - 1) {
+        vector<unsigned> endpoints;
+        for (unsigned v = 0; v < n; v++)
+            if (degree[v] < 2)
+                endpoints.push_back(v);
+        candidates.clear();
+        for (unsigned i = 0; i < endpoints.size(); i++)
+            for (unsigned j = i + 1; j < endpoints.size(); j++)
+                if (find(endpoints[i]) != find(endpoints[j]))
+                    candidates.emplace_back(endpoints[i], endpoints[j]);
+        sort(candidates.begin(), candidates.end(), shorter);
+        accept(candidates);
+    }
+
+    unsigned start = 0;
+    while (degree[start] != 1)
+        start++;
+    vector<unsigned> tour;
+    tour.reserve(n);
+    unsigned previous = n;
+    unsigned current = start;
+    while (tour.size() < n) {
+        tour.push_back(current);
+        unsigned following = adjacent[current][0] != previous ? adjacent[current][0]
+                                                               : (adjacent[current].size() > 1 ? adjacent[current][1] : n);
+        previous = current;
+        current = following;
+        if (current == n)
+            break;
+    }
+    return tour;
+}
+
+vector<unsigned> TourConstruction::hilbertCurve(const vector<pair<double, double>> &points) {
+    unsigned n = points.size();
+    if (!n)
+        return {};
+    double minX = points[0].first, maxX = points[0].first, minY = points[0].second, maxY = points[0].second;
+    for (const auto &point: points) {
+        minX = min(minX, point.first);
+        maxX = max(maxX, point.first);
+        minY = min(minY, point.second);
+        maxY = max(maxY, point.second);
+    }
+    double scale = (HILBERT_SIDE - 1) / max(max(maxX - minX, maxY - minY), numeric_limits<double>::min());
+    vector<pair<uint64_t, unsigned>> keys(n);
+    for (unsigned i = 0; i < n; i++) {
+        auto x = (uint32_t) ((points[i].first - minX) * scale);
+        auto y = (uint32_t) ((points[i].second - minY) * scale);
+        uint64_t d = 0;
+        for (uint32_t s = HILBERT_SIDE / 2; s > 0; s /= 2) {
+            uint32_t rx = (x & s) > 0;
+            uint32_t ry = (y & s) > 0;
+            d += (uint64_t) s * s * ((3 * rx) ^ ry);
+            if (!ry) {
+                if (rx) {
+                    x = s - 1 - x;
+                    y = s - 1 - y;
+                }
+                swap(x, y);
+            }
+        }
+        keys[i] = make_pair(d, i);
+    }
+    sort(keys.begin(), keys.end());
+    vector<unsigned> tour(n);
+    for (unsigned i = 0; i < n; i++)
+        tour[i] = keys[i].second;
+    return tour;
+}
+
+double TourConstruction::tourCost(const MetricClosure &closure, const vector<unsigned> &tour) {
+    double cost = 0.0;
+    for (unsigned i = 0; i < tour.size(); i++)
+        cost += closure.getDistance(tour[i], tour[(i + 1) % tour.size()]);
+    return cost;
+}
+
+vector<unsigned> TourConstruction::toCircuit(const vector<unsigned> &tour) {
+    vector<unsigned> circuit;
+    circuit.reserve(tour.size() + 1);
+    auto zero = find(tour.begin(), tour.end(), 0u);
+    circuit.insert(circuit.end(), zero, tour.end());
+    circuit.insert(circuit.end(), tour.begin(), zero);
+    circuit.push_back(0);
+    return circuit;
+}
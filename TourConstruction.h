@@ -0,0 +1,75 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#ifndef TSP_TOURCONSTRUCTION_H
+#define TSP_TOURCONSTRUCTION_H
+
+
+#include <random>
+#include <utility>
+#include <vector>
+#include "MetricClosure.h"
+
+class TourConstruction {
+public:
+    /**@brief Constrói um circuito através da heurística Nearest Neighbor aleatorizada: a partir de start, escolhe sucessivamente, de forma uniforme, um dos candidates vizinhos mais próximos por visitar.
+     *
+     * Complexidade Temporal: O(V<SUP>2</SUP> k), sendo V o número de vértices e k o número de candidatos
+     * @param closure fecho métrico do grafo
+     * @param start id do vértice inicial
+     * @param rng gerador de números aleatórios
+     * @param candidates número de vizinhos mais próximos entre os quais escolher (1 corresponde à heurística determinística)
+     * @return circuito construído (permutação dos vértices, sem repetir o vértice inicial no fim)
+     */
+    static std::vector<unsigned>
+    nearestNeighbor(const MetricClosure &closure, unsigned start, std::mt19937 &rng, unsigned candidates = 1);
+
+    /**@brief Constrói um circuito através da travessia em pré-ordem de uma Minimum Cost Spanning Tree (MST) determinada pelo algoritmo de Prim (versão densa) a partir de root.
+     *
+     * Complexidade Temporal: O(V<SUP>2</SUP>), sendo V o número de vértices
+     * @param closure fecho métrico do grafo
+     * @param root id da raiz da Minimum Cost Spanning Tree (MST)
+     * @param rng gerador de números aleatórios usado para baralhar a ordem dos filhos de cada vértice (opcional)
+     * @return circuito construído (permutação dos vértices, sem repetir o vértice inicial no fim)
+     */
+    static std::vector<unsigned> mstPreorder(const MetricClosure &closure, unsigned root, std::mt19937 *rng = nullptr);
+
+    /**@brief Constrói um circuito através da heurística Greedy Edge: percorre as arestas candidatas (entre cada vértice e os seus neighbors vizinhos mais próximos) por ordem crescente de distância e aceita cada uma se não criar um vértice de grau 3 nem um ciclo prematuro (union-find).
+     * Os fragmentos que sobram são ligados da mesma forma, considerando as arestas entre as suas extremidades.
+     *
+     * Complexidade Temporal: O(V<SUP>2</SUP> + V k log(V k) + F<SUP>2</SUP> log(F)), sendo V o número de vértices, k o número de vizinhos e F o número de fragmentos que sobram
+     * @param closure fecho métrico do grafo
+     * @param neighbors número de vizinhos mais próximos a considerar para cada vértice
+     * @return circuito construído (permutação dos vértices, sem repetir o vértice inicial no fim)
+     */
+    static std::vector<unsigned> greedyEdge(const MetricClosure &closure, unsigned neighbors = 10);
+
+    /**@brief Constrói um circuito através da ordem dos pontos ao longo de uma curva de Hilbert sobre a caixa que os delimita (pontos próximos no plano ficam próximos no circuito).
+     *
+     * Complexidade Temporal: O(n log(n)), sendo n o número de pontos
+     * @param points coordenadas (por exemplo, longitude e latitude) de cada vértice
+     * @return circuito construído (permutação dos índices dos pontos, sem repetir o vértice inicial no fim)
+     */
+    static std::vector<unsigned> hilbertCurve(const std::vector<std::pair<double, double>> &points);
+
+    /**@brief Calcula o custo do circuito tour, incluindo a aresta de regresso do último ao primeiro vértice.
+     *
+     * Complexidade Temporal: O(n), sendo n o tamanho do circuito
+     * @param closure fecho métrico do grafo
+     * @param tour circuito (permutação dos vértices, sem repetir o vértice inicial no fim)
+     * @return custo do circuito
+     */
+    static double tourCost(const MetricClosure &closure, const std::vector<unsigned> &tour);
+
+    /**@brief Converte o circuito tour para a representação usada pelo grafo: começa e acaba no vértice de id 0.
+     *
+     * Complexidade Temporal: O(n), sendo n o tamanho do circuito
+     * @param tour circuito (permutação dos vértices, sem repetir o vértice inicial no fim)
+     * @return circuito que começa e acaba no vértice de id 0
+     */
+    static std::vector<unsigned> toCircuit(const std::vector<unsigned> &tour);
+};
+
+
+#endif //TSP_TOURCONSTRUCTION_H
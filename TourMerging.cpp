@@ -0,0 +1,254 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#include "TourMerging.h"
+#include "TourConstruction.h"
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <unordered_map>
+
+using namespace std;
+
+#define UNSELECTED ((unsigned char) 0xFF)
+#define MAX_WIDTH 254u
+
+TourMerging::TourMerging(const MetricClosure &closure, unsigned maxStates) : closure(closure),
+                                                                              maxStates(max(1u, maxStates)) {}
+
+void TourMerging::add(const vector<unsigned> &circuit) {
+    vector<char> seen(closure.size(), false);
+    vector<unsigned> tour;
+    tour.reserve(closure.size());
+    for (unsigned v: circuit)
+        if (v < closure.size() && !seen[v]) {
+            seen[v] = true;
+            tour.push_back(v);
+        }
+    if (tour.size() != closure.size())
+        return;
+    tours.push_back(move(tour));
+    if (TourConstruction::tourCost(closure, tours.back()) < TourConstruction::tourCost(closure, tours[best]))
+        best = tours.size() - 1;
+}
+
+double TourMerging::merge(vector<unsigned> &circuit) {
+    unsigned n = closure.size();
+    unionEdges = 0;
+    width = 0;
+    exact = true;
+    if (tours.empty()) {
+        circuit.clear();
+        return numeric_limits<double>::infinity();
+    }
+    const vector<unsigned> &order = tours[best];
+    double bestCost = TourConstruction::tourCost(closure, order);
+    circuit = TourConstruction::toCircuit(order);
+    if (n < 4)
+        return bestCost;
+
+    vector<unsigned> rank(n);
+    for (unsigned i = 0; i < n; i++)
+        rank[order[i]] = i;
+    vector<pair<unsigned, unsigned>> all;
+    for (const auto &tour: tours)
+        for (unsigned i = 0; i < n; i++) {
+            unsigned u = tour[i], v = tour[(i + 1) % n];
+            all.emplace_back(min(u, v), max(u, v));
+        }
+    sort(all.begin(), all.end());
+    vector<pair<unsigned, unsigned>> edges;
+    vector<char> fixed;
+    for (unsigned i = 0, j; i < all.size(); i = j) {
+        for (j = i; j < all.size() && all[j] == all[i]; j++);
+        edges.push_back(all[i]);
+        fixed.push_back(j - i == tours.size());
+    }
+    unionEdges = edges.size();
+    vector<vector<unsigned>> incident(n);
+    for (unsigned e = 0; e < edges.size(); e++) {
+        incident[edges[e].first].push_back(e);
+        incident[edges[e].second].push_back(e);
+    }
+
+    struct Step {
+        unsigned parent;
+        int chosen[2];
+    };
+    struct State {
+        string mates;
+        double cost;
+        unsigned step;
+        bool guide;
+    };
+    auto edgeOf = [&edges](unsigned u, unsigned v) {
+        return (int) (lower_bound(edges.begin(), edges.end(), make_pair(min(u, v), max(u, v))) - edges.begin());
+    };
+    vector<Step> steps;
+    vector<State> layer = {{string(), 0.0, 0, true}};
+    steps.push_back({0, {-1, -1}});
+    vector<unsigned> frontier;
+    vector<unsigned> position(edges.size(), 0);
+    double finalCost = numeric_limits<double>::infinity();
+    unsigned finalStep = 0;
+
+    for (unsigned t = 0; t < n; t++) {
+        unsigned v = order[t];
+        vector<unsigned> in, out;
+        unsigned forced = 0;
+        for (unsigned e: incident[v]) {
+            unsigned u = edges[e].first == v ? edges[e].second : edges[e].first;
+            if (rank[u] < t)
+                in.push_back(position[e]);
+            else if (fixed[e])
+                out.insert(out.begin() + forced++, e);
+            else
+                out.push_back(e);
+        }
+        unsigned old = frontier.size();
+        vector<char> removed(old, false);
+        for (unsigned p: in)
+            removed[p] = true;
+        vector<unsigned> remap(old + out.size(), 0);
+        vector<unsigned> next;
+        for (unsigned p = 0; p < old; p++)
+            if (!removed[p]) {
+                remap[p] = next.size();
+                next.push_back(frontier[p]);
+            }
+        for (unsigned k = 0; k < out.size(); k++) {
+            remap[old + k] = next.size();
+            next.push_back(out[k]);
+        }
+        // O estado estendido tem old + out.size() posições, cada uma guardada num char diferente de UNSELECTED.
+        if (old + out.size() > MAX_WIDTH)
+            return bestCost;
+        width = max(width, (unsigned) next.size());
+
+        int guideFirst = t + 1 < n ? edgeOf(v, order[t + 1]) : -1;
+        int guideSecond = t == 0 ? edgeOf(v, order[n - 1]) : -1;
+        vector<State> following;
+        unordered_map<string, unsigned> seen;
+        auto emit = [&](const string &extended, double cost, unsigned parent, int first, int second, bool guide) {
+            guide = guide && ((first == guideFirst && second == guideSecond) || (first == guideSecond && second == guideFirst));
+            string mates(next.size(), (char) UNSELECTED);
+            for (unsigned p = 0; p < extended.size(); p++)
+                if (!(p < old && removed[p]) && (unsigned char) extended[p] != UNSELECTED)
+                    mates[remap[p]] = (char) remap[(unsigned char) extended[p]];
+            auto it = seen.find(mates);
+            if (it == seen.end()) {
+                seen.emplace(mates, following.size());
+                steps.push_back({parent, {first, second}});
+                following.push_back({move(mates), cost, (unsigned) steps.size() - 1, guide});
+            } else {
+                State &state = following[it->second];
+                state.guide = state.guide || guide;
+                if (cost < state.cost) {
+                    state.cost = cost;
+                    steps[state.step] = {parent, {first, second}};
+                }
+            }
+        };
+
+        for (const State &state: layer) {
+            string extended = state.mates + string(out.size(), (char) UNSELECTED);
+            vector<unsigned> selected;
+            bool dropped = false;
+            for (unsigned p: in)
+                if ((unsigned char) extended[p] != UNSELECTED)
+                    selected.push_back(p);
+                else
+                    dropped = dropped || fixed[frontier[p]];
+            if (dropped || selected.size() + forced > 2)
+                continue;
+            if (selected.size() == 2) {
+                unsigned a = selected[0], b = selected[1];
+                if ((unsigned char) extended[a] == b) {
+                    bool others = false;
+                    for (unsigned p = 0; p < extended.size() && !others; p++)
+                        others = p != a && p != b && (unsigned char) extended[p] != UNSELECTED;
+                    if (t == n - 1 && !others && state.cost < finalCost) {
+                        finalCost = state.cost;
+                        finalStep = state.step;
+                    }
+                    continue;
+                }
+                unsigned pa = (unsigned char) extended[a], pb = (unsigned char) extended[b];
+                extended[pa] = (char) pb;
+                extended[pb] = (char) pa;
+                emit(extended, state.cost, state.step, -1, -1, state.guide);
+            } else if (selected.size() == 1) {
+                unsigned pa = (unsigned char) extended[selected[0]];
+                for (unsigned k = 0; k < (forced ? 1 : out.size()); k++) {
+                    string copy = extended;
+                    copy[pa] = (char) (old + k);
+                    copy[old + k] = (char) pa;
+                    const auto &edge = edges[out[k]];
+                    emit(copy, state.cost + closure.getDistance(edge.first, edge.second), state.step, out[k], -1,
+                         state.guide);
+                }
+            } else
+                for (unsigned k = 0; k < (forced ? 1 : out.size()); k++)
+                    for (unsigned l = k + 1; l < (forced == 2 ? 2 : out.size()); l++) {
+                        string copy = extended;
+                        copy[old + k] = (char) (old + l);
+                        copy[old + l] = (char) (old + k);
+                        const auto &first = edges[out[k]], &second = edges[out[l]];
+                        emit(copy, state.cost + closure.getDistance(first.first, first.second)
+                                   + closure.getDistance(second.first, second.second), state.step, out[k], out[l],
+                             state.guide);
+                    }
+        }
+
+        if (following.size() > maxStates) {
+            exact = false;
+            nth_element(following.begin(), following.begin() + maxStates, following.end(),
+                        [](const State &a, const State &b) { return a.cost < b.cost; });
+            auto guide = find_if(following.begin() + maxStates, following.end(), [](const State &s) { return s.guide; });
+            if (guide != following.end())
+                swap(following[maxStates - 1], *guide);
+            following.resize(maxStates);
+        }
+        frontier = move(next);
+        for (unsigned p = 0; p < frontier.size(); p++)
+            position[frontier[p]] = p;
+        layer = move(following);
+    }
+
+    if (finalCost >= bestCost - 1e-9)
+        return bestCost;
+    vector<vector<unsigned>> adjacent(n);
+    for (unsigned s = finalStep; s != 0; s = steps[s].parent)
+        for (int e: steps[s].chosen)
+            if (e >= 0) {
+                adjacent[edges[e].first].push_back(edges[e].second);
+                adjacent[edges[e].second].push_back(edges[e].first);
+            }
+    vector<unsigned> tour = {order[0]};
+    unsigned previous = order[0], current = adjacent[order[0]][0];
+    while (current != order[0]) {
+        tour.push_back(current);
+        unsigned following = adjacent[current][0] != previous ? adjacent[current][0] : adjacent[current][1];
+        previous = current;
+        current = following;
+    }
+    circuit = TourConstruction::toCircuit(tour);
+    return finalCost;
+}
+
+double TourMerging::getBestInputCost() const {
+    return tours.empty() ? numeric_limits<double>::infinity() : TourConstruction::tourCost(closure, tours[best]);
+}
+
+unsigned TourMerging::getUnionEdges() const {
+    return unionEdges;
+}
+
+unsigned TourMerging::getWidth() const {
+    return width;
+}
+
+bool TourMerging::isExact() const {
+    return exact;
+}
@@ -0,0 +1,76 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#ifndef TSP_TOURMERGING_H
+#define TSP_TOURMERGING_H
+
+
+#include <vector>
+#include "MetricClosure.h"
+
+class TourMerging {
+public:
+    /**@brief Construtor com parâmetros. Prepara a fusão de circuitos sobre closure.
+     *
+     * Complexidade Temporal: O(V), sendo V o número de vértices
+     * @param closure fecho métrico do grafo
+     * @param maxStates número máximo de estados guardados em cada passo da programação dinâmica (acima deste número, são mantidos apenas os de menor custo e a solução deixa de ser garantidamente ótima no grafo união)
+     */
+    explicit TourMerging(const MetricClosure &closure, unsigned maxStates = 1000);
+
+    /**@brief Adiciona um circuito ao conjunto de circuitos a fundir. Os vértices repetidos (por exemplo, de um circuito expandido para usar apenas arestas reais) são ignorados depois da sua primeira ocorrência.
+     *
+     * Complexidade Temporal: O(n), sendo n o tamanho do circuito
+     * @param circuit circuito a adicionar (com ou sem o vértice inicial repetido no fim)
+     */
+    void add(const std::vector<unsigned> &circuit);
+
+    /**@brief Funde os circuitos adicionados: resolve o Travelling Salesperson Problem (TSP) restrito ao grafo união das arestas dos circuitos, por programação dinâmica sobre uma decomposição em caminho (os vértices são processados pela ordem do melhor circuito e o estado guarda as arestas da fronteira escolhidas e como as suas pontas estão ligadas).
+     *
+     * Complexidade Temporal: O(V S w<SUP>2</SUP>), sendo V o número de vértices, S o número de estados por passo e w a largura da fronteira
+     * @param circuit circuito encontrado (começa e acaba no vértice de id 0)
+     * @return custo do circuito encontrado (nunca pior do que o do melhor circuito adicionado)
+     */
+    double merge(std::vector<unsigned> &circuit);
+
+    /**@brief Retorna o custo do melhor circuito adicionado.
+     *
+     * Complexidade Temporal: O(1)
+     * @return custo do melhor circuito adicionado
+     */
+    double getBestInputCost() const;
+
+    /**@brief Retorna o número de arestas do grafo união usado na última fusão.
+     *
+     * Complexidade Temporal: O(1)
+     * @return número de arestas do grafo união
+     */
+    unsigned getUnionEdges() const;
+
+    /**@brief Retorna a largura máxima da fronteira (número de arestas entre os vértices processados e os restantes) na última fusão.
+     *
+     * Complexidade Temporal: O(1)
+     * @return largura máxima da fronteira
+     */
+    unsigned getWidth() const;
+
+    /**@brief Indica se a última fusão foi exata, i. e., se nenhum estado foi descartado por exceder o número máximo de estados.
+     *
+     * Complexidade Temporal: O(1)
+     * @return true se o circuito encontrado é ótimo no grafo união, false caso contrário
+     */
+    bool isExact() const;
+
+private:
+    const MetricClosure &closure;
+    unsigned maxStates;
+    std::vector<std::vector<unsigned>> tours;
+    unsigned best = 0;
+    unsigned unionEdges = 0;
+    unsigned width = 0;
+    bool exact = true;
+};
+
+
+#endif //TSP_TOURMERGING_H
@@ -0,0 +1,299 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#include "TsplibInstance.h"
+#include "MetricSolver.h"
+#include "TourConstruction.h"
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+#define TSPLIB_PI 3.141592
+#define TSPLIB_QUADRATIC_LIMIT 10000u
+#define TSPLIB_GRID_MIN 64u
+#define TSPLIB_POINTS_PER_CELL 2.0
+
+using namespace std;
+
+/**@brief Remove os espaços em branco no início e no fim de str.
+ *
+ * Complexidade Temporal: O(n), sendo n o comprimento de str
+ * @param str string
+ * @return str sem os espaços em branco no início e no fim
+ */
+static string trim(const string &str) {
+    size_t begin = str.find_first_not_of(" \t\r\n");
+    if (begin == string::npos)
+        return "";
+    size_t end = str.find_last_not_of(" \t\r\n");
+    return str.substr(begin, end - begin + 1);
+}
+
+/**@brief Converte uma coordenada GEO da TSPLIB (graus e minutos, DDD.MM) para radianos.
+ *
+ * Complexidade Temporal: O(1)
+ * @param value coordenada
+ * @return coordenada em radianos
+ */
+static double geoRadians(double value) {
+    double degrees = trunc(value);
+    return TSPLIB_PI * (degrees + 5.0 * (value - degrees) / 3.0) / 180.0;
+}
+
+TsplibInstance::TsplibInstance(const string &file) {
+    ifstream in("../files/" + file);
+    if (!in)
+        throw invalid_argument("Não foi possível abrir o ficheiro " + file + ".");
+    string line, type, format = "FUNCTION";
+    bool coordinates = false;
+    while (getline(in, line)) {
+        line = trim(line);
+        if (line.empty())
+            continue;
+        if (line == "EOF")
+            break;
+        if (line == "NODE_COORD_SECTION") {
+            if (!n)
+                throw invalid_argument("A secção NODE_COORD_SECTION aparece antes de DIMENSION.");
+            x.assign(n, 0.0);
+            y.assign(n, 0.0);
+            vector<char> seen(n, false);
+            for (unsigned i = 0; i < n; i++) {
+                unsigned id;
+                double a, b;
+                if (!(in >> id >> a >> b) || id < 1 || id > n || seen[id - 1])
+                    throw invalid_argument("A secção NODE_COORD_SECTION está incompleta ou tem ids inválidos.");
+                seen[id - 1] = true;
+                x[id - 1] = a;
+                y[id - 1] = b;
+            }
+            coordinates = true;
+            continue;
+        }
+        if (line == "EDGE_WEIGHT_SECTION") {
+            readMatrix(in, format);
+            continue;
+        }
+        if (line == "DISPLAY_DATA_SECTION") {
+            unsigned id;
+            double a, b;
+            for (unsigned i = 0; i < n && in >> id >> a >> b; i++);
+            continue;
+        }
+        size_t colon = line.find(':');
+        if (colon == string::npos)
+            throw invalid_argument("Linha inválida no ficheiro TSPLIB: " + line);
+        string key = trim(line.substr(0, colon));
+        string value = trim(line.substr(colon + 1));
+        if (key == "NAME") {
+            name = value;
+        } else if (key == "COMMENT") {
+            comment += (comment.empty() ? "" : " ") + value;
+        } else if (key == "TYPE") {
+            type = value;
+        } else if (key == "DIMENSION") {
+            istringstream dimension(value);
+            if (!(dimension >> n) || n < 1)
+                throw invalid_argument("DIMENSION inválida: " + value);
+        } else if (key == "EDGE_WEIGHT_TYPE") {
+            if (value == "EUC_2D")
+                weight = TsplibWeight::EUC_2D;
+            else if (value == "CEIL_2D")
+                weight = TsplibWeight::CEIL_2D;
+            else if (value == "GEO")
+                weight = TsplibWeight::GEO;
+            else if (value == "ATT")
+                weight = TsplibWeight::ATT;
+            else if (value == "EXPLICIT")
+                weight = TsplibWeight::EXPLICIT;
+            else
+                throw invalid_argument("Tipo de distância não suportado: " + value);
+        } else if (key == "EDGE_WEIGHT_FORMAT") {
+            format = value;
+        }
+    }
+    if (type != "TSP")
+        throw invalid_argument("O ficheiro não é uma instância TSP simétrica (TYPE: " + type + ").");
+    if (weight == TsplibWeight::EXPLICIT ? matrix.empty() : !coordinates)
+        throw invalid_argument("O ficheiro não tem as distâncias nem as coordenadas dos nós.");
+    if (weight == TsplibWeight::GEO) {
+        latitude.resize(n);
+        longitude.resize(n);
+        for (unsigned i = 0; i < n; i++) {
+            latitude[i] = geoRadians(x[i]);
+            longitude[i] = geoRadians(y[i]);
+        }
+    }
+}
+
+void TsplibInstance::readMatrix(istream &in, const string &format) {
+    if (!n)
+        throw invalid_argument("A secção EDGE_WEIGHT_SECTION aparece antes de DIMENSION.");
+    matrix.assign((size_t) n * n, 0.0);
+    auto read = [&in](double &value) {
+        if (!(in >> value))
+            throw invalid_argument("A secção EDGE_WEIGHT_SECTION está incompleta.");
+    };
+    auto set = [this](unsigned i, unsigned j, double value) {
+        matrix[(size_t) i * n + j] = value;
+        matrix[(size_t) j * n + i] = value;
+    };
+    double value;
+    if (format == "FULL_MATRIX") {
+        for (size_t k = 0; k < matrix.size(); k++)
+            read(matrix[k]);
+    } else if (format == "UPPER_ROW" || format == "LOWER_COL") {
+        for (unsigned i = 0; i < n; i++)
+            for (unsigned j = i + 1; j < n; j++) {
+                read(value);
+                set(i, j, value);
+            }
+    } else if (format == "LOWER_ROW" || format == "UPPER_COL") {
+        for (unsigned i = 0; i < n; i++)
+            for (unsigned j = 0; j < i; j++) {
+                read(value);
+                set(i, j, value);
+            }
+    } else if (format == "UPPER_DIAG_ROW" || format == "LOWER_DIAG_COL") {
+        for (unsigned i = 0; i < n; i++)
+            for (unsigned j = i; j < n; j++) {
+                read(value);
+                set(i, j, value);
+            }
+    } else if (format == "LOWER_DIAG_ROW" || format == "UPPER_DIAG_COL") {
+        for (unsigned i = 0; i < n; i++)
+            for (unsigned j = 0; j <= i; j++) {
+                read(value);
+                set(i, j, value);
+            }
+    } else {
+        throw invalid_argument("Formato de distâncias explícitas não suportado: " + format);
+    }
+}
+
+const string &TsplibInstance::getName() const {
+    return name;
+}
+
+const string &TsplibInstance::getComment() const {
+    return comment;
+}
+
+TsplibWeight TsplibInstance::getWeight() const {
+    return weight;
+}
+
+string TsplibInstance::getWeightName() const {
+    switch (weight) {
+        case TsplibWeight::EUC_2D:
+            return "EUC_2D";
+        case TsplibWeight::CEIL_2D:
+            return "CEIL_2D";
+        case TsplibWeight::GEO:
+            return "GEO";
+        case TsplibWeight::ATT:
+            return "ATT";
+        default:
+            return "EXPLICIT";
+    }
+}
+
+vector<unsigned> TsplibInstance::nearestNeighbors(unsigned neighbors) const {
+    if (weight == TsplibWeight::GEO || weight == TsplibWeight::EXPLICIT || n < TSPLIB_GRID_MIN)
+        return MetricSolver::nearestNeighbors(*this, neighbors);
+    unsigned count = min(neighbors, n - 1);
+    double minX = *min_element(x.begin(), x.end()), maxX = *max_element(x.begin(), x.end());
+    double minY = *min_element(y.begin(), y.end()), maxY = *max_element(y.begin(), y.end());
+    auto side = (unsigned) max(1.0, sqrt(n / TSPLIB_POINTS_PER_CELL));
+    double width = maxX > minX ? (maxX - minX) / side : 1.0;
+    double height = maxY > minY ? (maxY - minY) / side : 1.0;
+    auto cell = [side](double value, double origin, double size) {
+        return min(side - 1, (unsigned) ((value - origin) / size));
+    };
+    vector<unsigned> start(side * side + 1, 0), points(n), cellX(n), cellY(n);
+    for (unsigned v = 0; v < n; v++) {
+        cellX[v] = cell(x[v], minX, width);
+        cellY[v] = cell(y[v], minY, height);
+        start[cellY[v] * side + cellX[v] + 1]++;
+    }
+    for (unsigned c = 0; c < side * side; c++)
+        start[c + 1] += start[c];
+    vector<unsigned> next(start.begin(), start.end() - 1);
+    for (unsigned v = 0; v < n; v++)
+        points[next[cellY[v] * side + cellX[v]]++] = v;
+
+    vector<unsigned> result((size_t) n * count);
+    vector<pair<double, unsigned>> candidates;
+    double step = min(width, height);
+    for (unsigned v = 0; v < n; v++) {
+        candidates.clear();
+        for (unsigned r = 0; r < side; r++) {
+            int x0 = (int) cellX[v] - (int) r, x1 = (int) cellX[v] + (int) r;
+            int y0 = (int) cellY[v] - (int) r, y1 = (int) cellY[v] + (int) r;
+            auto visit = [&](int cx, int cy) {
+                if (cx < 0 || cy < 0 || cx >= (int) side || cy >= (int) side)
+                    return;
+                unsigned c = cy * side + cx;
+                for (unsigned k = start[c]; k < start[c + 1]; k++) {
+                    unsigned u = points[k];
+                    if (u == v)
+                        continue;
+                    double dx = x[u] - x[v], dy = y[u] - y[v];
+                    candidates.emplace_back(dx * dx + dy * dy, u);
+                }
+            };
+            for (int cx = x0; cx <= x1; cx++) {
+                visit(cx, y0);
+                if (y1 != y0)
+                    visit(cx, y1);
+            }
+            for (int cy = y0 + 1; cy < y1; cy++) {
+                visit(x0, cy);
+                visit(x1, cy);
+            }
+            if (candidates.size() >= count) {
+                nth_element(candidates.begin(), candidates.begin() + (count - 1), candidates.end());
+                double reach = r * step;
+                if (candidates[count - 1].first <= reach * reach)
+                    break;
+            }
+        }
+        partial_sort(candidates.begin(), candidates.begin() + count, candidates.end());
+        for (unsigned k = 0; k < count; k++)
+            result[(size_t) v * count + k] = candidates[k].second;
+    }
+    return result;
+}
+
+vector<unsigned> TsplibInstance::construct(bool &hilbert) const {
+    vector<unsigned> tour;
+    hilbert = n > TSPLIB_QUADRATIC_LIMIT && weight != TsplibWeight::EXPLICIT;
+    if (!hilbert) {
+        MetricSolver::nearestNeighbor(*this, tour);
+        return tour;
+    }
+    vector<pair<double, double>> points(n);
+    for (unsigned v = 0; v < n; v++)
+        points[v] = make_pair(x[v], y[v]);
+    return TourConstruction::hilbertCurve(points);
+}
+
+bool TsplibInstance::readTour(const string &file, vector<unsigned> &tour) const {
+    ifstream in("../files/" + file);
+    string line;
+    while (getline(in, line) && trim(line) != "TOUR_SECTION");
+    if (!in)
+        return false;
+    tour.clear();
+    vector<char> seen(n, false);
+    long id;
+    while (in >> id && id != -1) {
+        if (id < 1 || id > (long) n || seen[id - 1])
+            return false;
+        seen[id - 1] = true;
+        tour.push_back(id - 1);
+    }
+    return tour.size() == n;
+}
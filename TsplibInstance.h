@@ -0,0 +1,146 @@
+//
+// Created by manue on 19/10/2026.
+//
+
+#ifndef TSP_TSPLIBINSTANCE_H
+#define TSP_TSPLIBINSTANCE_H
+
+
+#include <cmath>
+#include <iosfwd>
+#include <string>
+#include <utility>
+#include <vector>
+
+#define TSPLIB_GEO_RADIUS 6378.388
+
+/**@brief Tipos de distância (EDGE_WEIGHT_TYPE) de instâncias TSPLIB suportados.
+ */
+enum class TsplibWeight {
+    EUC_2D, CEIL_2D, GEO, ATT, EXPLICIT
+};
+
+class TsplibInstance {
+public:
+    /**@brief Construtor com parâmetros. Lê a instância TSPLIB (TYPE: TSP) do ficheiro file. As distâncias não são materializadas: são calculadas a pedido a partir das coordenadas, segundo as regras de arredondamento da TSPLIB (exceto em EXPLICIT, em que a matriz é lida nos formatos FULL_MATRIX, UPPER_ROW, LOWER_ROW, UPPER_DIAG_ROW, LOWER_DIAG_ROW e nos equivalentes por colunas).
+     *
+     * Complexidade Temporal: O(n), sendo n o tamanho do ficheiro
+     * @throws std::invalid_argument se o ficheiro não existe, não é uma instância TSP ou usa um tipo ou formato de distância não suportado
+     * @param file caminho do ficheiro, relativo ao diretório files
+     */
+    explicit TsplibInstance(const std::string &file);
+
+    /**@brief Retorna o número de vértices (DIMENSION).
+     *
+     * Complexidade Temporal: O(1)
+     * @return número de vértices
+     */
+    unsigned size() const {
+        return n;
+    }
+
+    /**@brief Retorna a distância TSPLIB entre os vértices de id orig e dest (os ids são os da TSPLIB menos 1), calculada a pedido.
+     *
+     * Complexidade Temporal: O(1)
+     * @param orig id do vértice de origem
+     * @param dest id do vértice de destino
+     * @return distância entre os vértices (inteira, como definida pela TSPLIB)
+     */
+    double operator()(unsigned orig, unsigned dest) const {
+        if (orig == dest)
+            return 0.0;
+        if (weight == TsplibWeight::EXPLICIT)
+            return matrix[(std::size_t) orig * n + dest];
+        double dx = x[orig] - x[dest];
+        double dy = y[orig] - y[dest];
+        if (weight == TsplibWeight::EUC_2D)
+            return std::floor(std::sqrt(dx * dx + dy * dy) + 0.5);
+        if (weight == TsplibWeight::CEIL_2D)
+            return std::ceil(std::sqrt(dx * dx + dy * dy));
+        if (weight == TsplibWeight::ATT) {
+            double r = std::sqrt((dx * dx + dy * dy) / 10.0);
+            double t = std::floor(r + 0.5);
+            return t < r ? t + 1.0 : t;
+        }
+        double q1 = std::cos(longitude[orig] - longitude[dest]);
+        double q2 = std::cos(latitude[orig] - latitude[dest]);
+        double q3 = std::cos(latitude[orig] + latitude[dest]);
+        return std::floor(TSPLIB_GEO_RADIUS * std::acos(0.5 * ((1.0 + q1) * q2 - (1.0 - q1) * q3)) + 1.0);
+    }
+
+    /**@brief Retorna o nome da instância (NAME).
+     *
+     * Complexidade Temporal: O(1)
+     * @return nome da instância
+     */
+    const std::string &getName() const;
+
+    /**@brief Retorna o comentário da instância (COMMENT).
+     *
+     * Complexidade Temporal: O(1)
+     * @return comentário da instância (vazio se não existir)
+     */
+    const std::string &getComment() const;
+
+    /**@brief Retorna o tipo de distância da instância.
+     *
+     * Complexidade Temporal: O(1)
+     * @return tipo de distância
+     */
+    TsplibWeight getWeight() const;
+
+    /**@brief Retorna o nome do tipo de distância da instância, como na TSPLIB (EDGE_WEIGHT_TYPE).
+     *
+     * Complexidade Temporal: O(1)
+     * @return nome do tipo de distância
+     */
+    std::string getWeightName() const;
+
+    /**@brief Determina, para cada vértice, os seus neighbors vizinhos mais próximos. Para distâncias euclidianas (EUC_2D, CEIL_2D, ATT), usa uma grelha uniforme sobre as coordenadas e percorre apenas os anéis de células necessários; nos restantes casos, compara todos os pares.
+     *
+     * Complexidade Temporal: O(V k log(k)) em média com coordenadas uniformes, O(V<SUP>2</SUP> log(k)) nos restantes casos, sendo V o número de vértices e k o número de vizinhos
+     * @param neighbors número de vizinhos mais próximos de cada vértice
+     * @return listas de vizinhos mais próximos, por ordem crescente de distância (min(neighbors, V - 1) por vértice, contíguas)
+     */
+    std::vector<unsigned> nearestNeighbors(unsigned neighbors) const;
+
+    /**@brief Constrói um circuito inicial: Nearest Neighbor para instâncias pequenas ou com distâncias explícitas, e a ordem dos vértices ao longo de uma curva de Hilbert para instâncias grandes com coordenadas.
+     *
+     * Complexidade Temporal: O(V<SUP>2</SUP>) com Nearest Neighbor, O(V log(V)) com a curva de Hilbert, sendo V o número de vértices
+     * @param hilbert true se foi usada a curva de Hilbert, false se foi usado Nearest Neighbor
+     * @return circuito construído (permutação dos vértices, sem repetir o vértice inicial no fim)
+     */
+    std::vector<unsigned> construct(bool &hilbert) const;
+
+    /**@brief Lê um circuito TSPLIB (TOUR_SECTION, por exemplo de um ficheiro .opt.tour com o circuito ótimo) do ficheiro file.
+     *
+     * Complexidade Temporal: O(n), sendo n o tamanho do ficheiro
+     * @param file caminho do ficheiro, relativo ao diretório files
+     * @param tour circuito lido (ids da TSPLIB menos 1, sem repetir o vértice inicial no fim)
+     * @return true se o ficheiro existe e contém uma permutação dos vértices da instância, false caso contrário
+     */
+    bool readTour(const std::string &file, std::vector<unsigned> &tour) const;
+
+private:
+    std::string name;
+    std::string comment;
+    TsplibWeight weight = TsplibWeight::EUC_2D;
+    unsigned n = 0;
+    std::vector<double> x;
+    std::vector<double> y;
+    std::vector<double> latitude;
+    std::vector<double> longitude;
+    std::vector<double> matrix;
+
+    /**@brief Lê a matriz de distâncias explícitas (EDGE_WEIGHT_SECTION) no formato format.
+     *
+     * Complexidade Temporal: O(V<SUP>2</SUP>), sendo V o número de vértices
+     * @throws std::invalid_argument se o formato não é suportado ou a secção está incompleta
+     * @param in stream posicionada no início da secção
+     * @param format formato da matriz (EDGE_WEIGHT_FORMAT)
+     */
+    void readMatrix(std::istream &in, const std::string &format);
+};
+
+
+#endif //TSP_TSPLIBINSTANCE_H
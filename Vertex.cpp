@@ -10,10 +10,6 @@ using namespace std;
 
 Vertex::Vertex(unsigned id, double longitude, double latitude) : id(id), longitude(longitude), latitude(latitude) {}
 
-bool Vertex::operator<(const Vertex &vertex) const {
-    return this->distance < vertex.distance;
-}
-
 unsigned Vertex::getId() const {
     return this->id;
 }
@@ -26,34 +22,10 @@ double Vertex::getLatitude() const {
     return this->latitude;
 }
 
-multiset<Edge *, edgeCmp> Vertex::getAdj() const {
+const multiset<Edge *, edgeCmp> &Vertex::getAdj() const {
     return this->adj;
 }
 
-bool Vertex::isVisited() const {
-    return this->visited;
-}
-
-double Vertex::getDistance() const {
-    return this->distance;
-}
-
-Edge *Vertex::getPath() const {
-    return this->path;
-}
-
-void Vertex::setVisited(bool visited) {
-    this->visited = visited;
-}
-
-void Vertex::setDistance(double distance) {
-    this->distance = distance;
-}
-
-void Vertex::setPath(Edge *path) {
-    this->path = path;
-}
-
 Edge *Vertex::addEdge(Vertex *dest, double distance) {
     Edge *newEdge = new Edge(this, dest, distance);
     adj.insert(newEdge);
@@ -61,6 +33,15 @@ Edge *Vertex::addEdge(Vertex *dest, double distance) {
     return newEdge;
 }
 
+void Vertex::setEdgeDistance(Edge *edge, double distance) {
+    Vertex *dest = edge->getDest();
+    eraseEdge(adj, edge);
+    eraseEdge(dest->incoming, edge);
+    edge->setDistance(distance);
+    adj.insert(edge);
+    dest->incoming.insert(edge);
+}
+
 Edge *Vertex::getEdge(const Vertex *vertex) const {
     for (Edge *edge: adj)
         if (edge->getDest()->getId() == vertex->getId())
@@ -68,20 +49,20 @@ Edge *Vertex::getEdge(const Vertex *vertex) const {
     return nullptr;
 }
 
-Edge *Vertex::getNearestNeighbor() const {
+Edge *Vertex::getNearestNeighbor(const SolverState &state) const {
     for (Edge *edge: adj)
-        if (!edge->getDest()->isVisited())
+        if (!state.isVisited(edge->getDest()->getId()))
             return edge;
     return nullptr;
 }
 
-void Vertex::dfsPreorder(vector<unsigned> &preorder) {
-    this->visited = true;
+void Vertex::dfsPreorder(vector<unsigned> &preorder, SolverState &state) const {
+    state.setVisited(this->id, true);
     preorder.push_back(this->id);
     for (auto edge: this->adj) {
         auto v = edge->getDest();
-        if (!v->isVisited())
-            v->dfsPreorder(preorder);
+        if (!state.isVisited(v->getId()))
+            v->dfsPreorder(preorder, state);
     }
 }
 
@@ -103,3 +84,12 @@ double Vertex::calculateDistance(const Vertex *vertex) const {
 double Vertex::toRadians(double deg) {
     return deg * 3.1416 / 180;
 }
+
+void Vertex::eraseEdge(multiset<Edge *, edgeCmp> &edges, Edge *edge) {
+    auto range = edges.equal_range(edge);
+    for (auto it = range.first; it != range.second; it++)
+        if (*it == edge) {
+            edges.erase(it);
+            return;
+        }
+}
@@ -8,7 +8,7 @@
 
 #include <set>
 #include "Edge.h"
-#include "MutablePriorityQueue.h"
+#include "SolverState.h"
 
 class Vertex {
 public:
@@ -21,14 +21,6 @@ public:
      */
     Vertex(unsigned id, double longitude, double latitude);
 
-    /**@brief Compara o vértice e vertex quanto à sua distância.
-     *
-     * Complexidade Temporal: O(1)
-     * @param vertex vértice com o qual comparar
-     * @return true se a distância do vértice é inferior à de vertex, false caso contrário
-     */
-    bool operator<(const Vertex &vertex) const;
-
     /**@brief Retorna o id do vértice.
      *
      * Complexidade Temporal: O(1)
@@ -55,49 +47,7 @@ public:
      * Complexidade Temporal: O(1)
      * @return lista de adjacências (arestas a sair) do vértice
      */
-    std::multiset<Edge *, edgeCmp> getAdj() const;
-
-    /**@brief Indica se o vértice foi visitado.
-     *
-     * Complexidade Temporal: O(1)
-     * @return true se o vértice foi visitado, false caso contrário
-     */
-    bool isVisited() const;
-
-    /**@brief Retorna a distância do vértice
-     *
-     * Complexidade Temporal: O(1)
-     * @return distância do vértice
-     */
-    double getDistance() const;
-
-    /**@brief Retorna a aresta predecessora do vértice no caminho atual.
-     *
-     * Complexidade Temporal: O(1)
-     * @return aresta predecessora do vértice no caminho atual
-     */
-    Edge *getPath() const;
-
-    /**@brief Define estado visitado do vértice como visited.
-     *
-     * Complexidade Temporal: O(1)
-     * @param visited novo estado visitado do vértice
-     */
-    void setVisited(bool visited);
-
-    /**@brief Define a distância do vértice como distance.
-     *
-     * Complexidade Temporal: O(1)
-     * @param cost nova distância do vértice
-     */
-    void setDistance(double distance);
-
-    /**@brief Define a aresta predecessora do vértice como path.
-     *
-     * Complexidade Temporal: O(1)
-     * @param path nova aresta predecessora do vértice
-     */
-    void setPath(Edge *path);
+    const std::multiset<Edge *, edgeCmp> &getAdj() const;
 
     /**@brief Adiciona ao vértice um aresta com destino dest e distância distance.
      *
@@ -108,6 +58,14 @@ public:
      */
     Edge *addEdge(Vertex *dest, double distance);
 
+    /**@brief Altera a distância da aresta edge, que sai do vértice, para distance, mantendo ordenadas as listas de adjacências da origem e do destino.
+     *
+     * Complexidade Temporal: O(log n), sendo n o tamanho da lista de adjacências (arestas a sair) do vértice
+     * @param edge aresta a alterar
+     * @param distance nova distância da aresta
+     */
+    void setEdgeDistance(Edge *edge, double distance);
+
     /**@brief Retorna (se existir) a aresta com origem no vértice e destino em vertex.
      *
      * Complexidade Temporal: O(n), sendo n o tamanho da lista de adjacências (arestas a sair) do vértice
@@ -118,16 +76,18 @@ public:
     /**@brief Retorna (se existir) a aresta com destino no vértice vizinho (adjacente) mais próximo por visitar.
      *
      * Complexidade Temporal: O(n), sendo n o tamanho da lista de adjacências (arestas a sair) do vértice
+     * @param state estado da execução atual, que indica os vértices já visitados
      * @return aresta com destino no vértice vizinho (adjacente) mais próximo por visitar
      */
-    Edge *getNearestNeighbor() const;
+    Edge *getNearestNeighbor(const SolverState &state) const;
 
     /**@brief Realiza uma Pesquisa em Profundidade (DFS) em pré-ordem a partir do vértice.
      *
      * Complexidade Temporal: O(V + E), sendo V o número de vértices do grafo em que o vértice está inserido e E o número de arestas do grafo em que o vértice está inserido
      * @param preorder travessia em pré-ordem determinada
+     * @param state estado da execução atual, que indica os vértices já visitados
      */
-    void dfsPreorder(std::vector<unsigned> &preorder);
+    void dfsPreorder(std::vector<unsigned> &preorder, SolverState &state) const;
 
     /**@brief Calcula a distância entre o vértice e vertex através do método de Haversine.
      *
@@ -137,18 +97,12 @@ public:
      */
     double calculateDistance(const Vertex *vertex) const;
 
-    friend class MutablePriorityQueue<Vertex>;
-
 private:
     unsigned id;
     double longitude;
     double latitude;
     std::multiset<Edge *, edgeCmp> adj;
-    bool visited = false;
-    double distance = 0.0;
-    Edge *path = nullptr;
     std::multiset<Edge *, edgeCmp> incoming;
-    int queueIndex;
 
     /**@brief Converte um ângulo em graus para radianos.
      *
@@ -157,6 +111,14 @@ private:
      * @return ângulo convertido para radianos
      */
     static double toRadians(double deg);
+
+    /**@brief Remove a aresta edge (comparando apontadores, e não apenas distâncias) da lista de adjacências edges.
+     *
+     * Complexidade Temporal: O(log n + k), sendo n o tamanho da lista de adjacências e k o número de arestas com a mesma distância de edge
+     * @param edges lista de adjacências
+     * @param edge aresta a remover
+     */
+    static void eraseEdge(std::multiset<Edge *, edgeCmp> &edges, Edge *edge);
 };
 
 
@@ -1,9 +1,22 @@
 #include <iostream>
+#include <string>
 #include "Management.h"
+#include "Benchmark.h"
 
 using namespace std;
 
-int main() {
+int main(int argc, char *argv[]) {
+    if (argc > 1 && string(argv[1]) == "--benchmark") {
+        bool update = false;
+        string baseline = "../results/baseline.csv";
+        for (int i = 2; i < argc; i++) {
+            if (string(argv[i]) == "--update")
+                update = true;
+            else
+                baseline = argv[i];
+        }
+        return Benchmark().execute(baseline, update, cout) ? 0 : 1;
+    }
     Management management;
     while (management.menu())
         cout << endl;